@@ -0,0 +1,221 @@
+# Generates page_index.parquet: a file with small pages and a page index (ColumnIndex/OffsetIndex)
+# The file is written by hand (using the Thrift compact protocol) so we control the page boundaries exactly
+#
+# Schema:
+#   id  BIGINT NOT NULL   - 0..19999, pages of 1000 rows, with column index and offset index
+#   val BIGINT            - id * 10, NULL if id % 97 = 0 and for the rows 3500..4199 of every row group
+#                           pages of 700 rows, with column index and offset index
+#   s   VARCHAR NOT NULL  - 'str' || id, pages of 1500 rows, only an offset index
+# There are two row groups of 10000 rows each
+import struct
+
+ROW_GROUP_SIZE = 10000
+ROW_GROUP_COUNT = 2
+
+# Thrift compact protocol types
+BOOL_TRUE, BOOL_FALSE, I32, I64, BINARY, LIST, STRUCT = 1, 2, 5, 6, 8, 9, 12
+
+
+def varint(n):
+    out = bytearray()
+    while True:
+        b = n & 0x7F
+        n >>= 7
+        if n:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return bytes(out)
+
+
+def zigzag(n):
+    return (n << 1) ^ (n >> 63)
+
+
+class Struct:
+    def __init__(self):
+        self.fields = []
+
+    def add(self, field_id, field_type, value):
+        self.fields.append((field_id, field_type, value))
+        return self
+
+
+def encode_value(field_type, value):
+    if field_type in (I32, I64):
+        return varint(zigzag(value))
+    if field_type == BINARY:
+        if isinstance(value, str):
+            value = value.encode()
+        return varint(len(value)) + value
+    if field_type == STRUCT:
+        return encode_struct(value)
+    if field_type == LIST:
+        elem_type, elems = value
+        header = bytes([(len(elems) << 4) | elem_type]) if len(elems) < 15 else bytes([0xF0 | elem_type]) + varint(len(elems))
+        if elem_type == BOOL_TRUE:
+            return header + bytes([BOOL_TRUE if e else BOOL_FALSE for e in elems])
+        return header + b''.join(encode_value(elem_type, e) for e in elems)
+    raise Exception('unsupported type')
+
+
+def encode_struct(s):
+    out = bytearray()
+    last_id = 0
+    for field_id, field_type, value in sorted(s.fields, key=lambda f: f[0]):
+        delta = field_id - last_id
+        assert 0 < delta <= 15
+        out.append((delta << 4) | field_type)
+        out += encode_value(field_type, value)
+        last_id = field_id
+    out.append(0)
+    return bytes(out)
+
+
+def rle_levels(levels):
+    # RLE runs of a bit-width 1 level stream, prefixed with the byte length
+    out = bytearray()
+    i = 0
+    while i < len(levels):
+        j = i
+        while j < len(levels) and levels[j] == levels[i]:
+            j += 1
+        out += varint((j - i) << 1)
+        out.append(levels[i])
+        i = j
+    return struct.pack('<I', len(out)) + bytes(out)
+
+
+def column_values(name, row_start, row_end):
+    result = []
+    for i in range(row_start, row_end):
+        if name == 'id':
+            result.append(i)
+        elif name == 'val':
+            result.append(None if i % 97 == 0 or 3500 <= i % ROW_GROUP_SIZE < 4200 else i * 10)
+        else:
+            result.append('str%d' % i)
+    return result
+
+
+def encode_plain(name, value):
+    if name == 's':
+        return struct.pack('<I', len(value)) + value.encode()
+    return struct.pack('<q', value)
+
+
+def encode_stat(name, value):
+    if name == 's':
+        return value.encode()
+    return struct.pack('<q', value)
+
+
+COLUMNS = [
+    # name, page size, optional, has column index
+    ('id', 1000, False, True),
+    ('val', 700, True, True),
+    ('s', 1500, False, False),
+]
+
+data = bytearray(b'PAR1')
+row_groups = []
+page_indexes = []
+for rg in range(ROW_GROUP_COUNT):
+    rg_start = rg * ROW_GROUP_SIZE
+    chunks = []
+    for name, page_size, optional, has_column_index in COLUMNS:
+        chunk_start = len(data)
+        locations = []
+        null_pages, min_values, max_values, null_counts = [], [], [], []
+        for page_start in range(0, ROW_GROUP_SIZE, page_size):
+            page_end = min(page_start + page_size, ROW_GROUP_SIZE)
+            values = column_values(name, rg_start + page_start, rg_start + page_end)
+            body = bytearray()
+            if optional:
+                body += rle_levels([0 if v is None else 1 for v in values])
+            valid = [v for v in values if v is not None]
+            for v in valid:
+                body += encode_plain(name, v)
+            page_header = Struct().add(1, I32, 0).add(2, I32, len(body)).add(3, I32, len(body))
+            data_page_header = Struct().add(1, I32, len(values)).add(2, I32, 0).add(3, I32, 3).add(4, I32, 3)
+            page_header.add(5, STRUCT, data_page_header)
+            header = encode_struct(page_header)
+            locations.append(
+                Struct()
+                .add(1, I64, len(data))
+                .add(2, I32, len(header) + len(body))
+                .add(3, I64, page_start)
+            )
+            data += header + body
+            null_pages.append(len(valid) == 0)
+            min_values.append(encode_stat(name, min(valid)) if valid else b'')
+            max_values.append(encode_stat(name, max(valid)) if valid else b'')
+            null_counts.append(len(values) - len(valid))
+        all_values = column_values(name, rg_start, rg_start + ROW_GROUP_SIZE)
+        valid = [v for v in all_values if v is not None]
+        statistics = (
+            Struct()
+            .add(3, I64, len(all_values) - len(valid))
+            .add(5, BINARY, encode_stat(name, max(valid)))
+            .add(6, BINARY, encode_stat(name, min(valid)))
+        )
+        meta_data = (
+            Struct()
+            .add(1, I32, 6 if name == 's' else 2)
+            .add(2, LIST, (I32, [0, 3]))
+            .add(3, LIST, (BINARY, [name]))
+            .add(4, I32, 0)
+            .add(5, I64, ROW_GROUP_SIZE)
+            .add(6, I64, len(data) - chunk_start)
+            .add(7, I64, len(data) - chunk_start)
+            .add(9, I64, chunk_start)
+            .add(12, STRUCT, statistics)
+        )
+        column_index = None
+        if has_column_index:
+            column_index = (
+                Struct()
+                .add(1, LIST, (BOOL_TRUE, null_pages))
+                .add(2, LIST, (BINARY, min_values))
+                .add(3, LIST, (BINARY, max_values))
+                .add(4, I32, 0)
+                .add(5, LIST, (I64, null_counts))
+            )
+        offset_index = Struct().add(1, LIST, (STRUCT, locations))
+        chunk = Struct().add(2, I64, chunk_start).add(3, STRUCT, meta_data)
+        chunks.append(chunk)
+        page_indexes.append((chunk, column_index, offset_index))
+    row_groups.append(
+        Struct().add(1, LIST, (STRUCT, chunks)).add(2, I64, 0).add(3, I64, ROW_GROUP_SIZE)
+    )
+
+# the page index is written after all row groups: first all column indexes, then all offset indexes
+for chunk, column_index, _ in page_indexes:
+    if column_index is not None:
+        encoded = encode_struct(column_index)
+        chunk.add(6, I64, len(data)).add(7, I32, len(encoded))
+        data += encoded
+for chunk, _, offset_index in page_indexes:
+    encoded = encode_struct(offset_index)
+    chunk.add(4, I64, len(data)).add(5, I32, len(encoded))
+    data += encoded
+
+schema = [
+    Struct().add(4, BINARY, 'schema').add(5, I32, len(COLUMNS)),
+    Struct().add(1, I32, 2).add(3, I32, 0).add(4, BINARY, 'id'),
+    Struct().add(1, I32, 2).add(3, I32, 1).add(4, BINARY, 'val'),
+    Struct().add(1, I32, 6).add(3, I32, 0).add(4, BINARY, 's').add(6, I32, 0),
+]
+file_meta_data = (
+    Struct()
+    .add(1, I32, 1)
+    .add(2, LIST, (STRUCT, schema))
+    .add(3, I64, ROW_GROUP_SIZE * ROW_GROUP_COUNT)
+    .add(4, LIST, (STRUCT, row_groups))
+    .add(6, BINARY, 'page_index.py')
+)
+footer = encode_struct(file_meta_data)
+data += footer + struct.pack('<I', len(footer)) + b'PAR1'
+
+with open('page_index.parquet', 'wb') as f:
+    f.write(data)
@@ -188,6 +188,18 @@ unique_ptr<BaseStatistics> ColumnReader::Stats(idx_t row_group_idx_p, const vect
 	return ParquetStatisticsUtils::TransformColumnStatistics(*this, columns);
 }
 
+unique_ptr<BaseStatistics> ColumnReader::PageStats(const duckdb_parquet::format::Statistics &page_stats) {
+	if (HasRepeats()) {
+		return nullptr;
+	}
+	return ParquetStatisticsUtils::TransformColumnStatistics(*this, page_stats);
+}
+
+void ColumnReader::SetPageLocations(vector<duckdb_parquet::format::PageLocation> page_locations_p) {
+	D_ASSERT(!HasRepeats());
+	page_locations = std::move(page_locations_p);
+}
+
 void ColumnReader::Plain(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, idx_t num_values, // NOLINT
                          parquet_filter_t &filter, idx_t result_offset, Vector &result) {
 	throw NotImplementedException("Plain");
@@ -238,6 +250,9 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	page_rows_available = 0;
+	pending_skips = 0;
+	page_locations.clear();
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -600,9 +615,48 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (page_locations.empty() || num_values <= page_rows_available) {
+		return num_values;
+	}
+	// without repeats every value is a row, so we can find the page that contains the target row
+	const auto row_idx = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	const auto target_row = row_idx + num_values;
+	auto entry = std::upper_bound(page_locations.begin(), page_locations.end(), target_row,
+	                              [](idx_t row, const duckdb_parquet::format::PageLocation &location) {
+		                              return row < NumericCast<idx_t>(location.first_row_index);
+	                              });
+	D_ASSERT(entry != page_locations.begin());
+	auto &page = *(entry - 1);
+	const auto page_start = NumericCast<idx_t>(page.first_row_index);
+	if (page_start <= row_idx + page_rows_available) {
+		// the target row is in the current or the next page, nothing to jump over
+		return num_values;
+	}
+
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	// the dictionary page precedes the data pages, make sure we have read it before jumping ahead
+	while (chunk_read_offset < NumericCast<idx_t>(page_locations[0].offset)) {
+		trans.SetLocation(chunk_read_offset);
+		PrepareRead(none_filter);
+		chunk_read_offset = trans.GetLocation();
+	}
+
+	chunk_read_offset = NumericCast<idx_t>(page.offset);
+	trans.SetLocation(chunk_read_offset);
+	page_rows_available = 0;
+
+	const auto skipped = page_start - row_idx;
+	group_rows_available -= skipped;
+	return num_values - skipped;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	// first jump over any pages that we do not need to decode at all
+	num_values = SkipPages(num_values);
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
@@ -1023,6 +1077,14 @@ unique_ptr<BaseStatistics> CastColumnReader::Stats(idx_t row_group_idx_p, const
 	return nullptr;
 }
 
+unique_ptr<BaseStatistics> CastColumnReader::PageStats(const duckdb_parquet::format::Statistics &page_stats) {
+	return nullptr;
+}
+
+void CastColumnReader::SetPageLocations(vector<duckdb_parquet::format::PageLocation> page_locations_p) {
+	child_reader->SetPageLocations(std::move(page_locations_p));
+}
+
 void CastColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns,
                                       TProtocol &protocol_p) {
 	child_reader->InitializeRead(row_group_idx_p, columns, protocol_p);
@@ -1109,6 +1171,14 @@ unique_ptr<BaseStatistics> ExpressionColumnReader::Stats(idx_t row_group_idx_p,
 	return nullptr;
 }
 
+unique_ptr<BaseStatistics> ExpressionColumnReader::PageStats(const duckdb_parquet::format::Statistics &page_stats) {
+	return nullptr;
+}
+
+void ExpressionColumnReader::SetPageLocations(vector<duckdb_parquet::format::PageLocation> page_locations_p) {
+	child_reader->SetPageLocations(std::move(page_locations_p));
+}
+
 void ExpressionColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns,
                                             TProtocol &protocol_p) {
 	child_reader->InitializeRead(row_group_idx_p, columns, protocol_p);
@@ -1,6 +1,7 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -355,6 +356,8 @@ public:
 	vector<PageInformation> page_info;
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
+	//! The Bloom filter of the column chunk, if one is written
+	unique_ptr<ParquetBloomFilter> bloom_filter;
 	idx_t current_page = 0;
 };
 
@@ -416,6 +419,10 @@ protected:
 	//! Writes a (subset of a) vector to the specified serializer. Only used for scalar types.
 	virtual void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                         Vector &vector, idx_t chunk_start, idx_t chunk_end) = 0;
+	//! Inserts the hashes of the (plain-encoded) values of a vector into the Bloom filter of the column chunk
+	virtual void UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start, idx_t chunk_end);
+	//! The number of distinct values the Bloom filter of the column chunk is sized for
+	virtual idx_t BloomFilterEntryCount(BasicColumnWriterState &state);
 
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
@@ -426,6 +433,7 @@ protected:
 	virtual void FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats);
 
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
+	void WriteBloomFilter(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
 };
 
@@ -495,6 +503,10 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	if (max_repeat == 0 && schema_path.size() == 1 && writer.HasBloomFilter(schema_path[0])) {
+		state.bloom_filter = make_uniq<ParquetBloomFilter>(
+		    Allocator::DefaultAllocator(), BloomFilterEntryCount(state), writer.BloomFilterFalsePositiveRatio());
+	}
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -615,6 +627,17 @@ unique_ptr<ColumnWriterStatistics> BasicColumnWriter::InitializeStatsState() {
 	return make_uniq<ColumnWriterStatistics>();
 }
 
+void BasicColumnWriter::UpdateBloomFilter(BasicColumnWriterState &state, Vector &vector, idx_t chunk_start,
+                                          idx_t chunk_end) {
+	throw InternalException("This column writer does not support Bloom filters");
+}
+
+idx_t BasicColumnWriter::BloomFilterEntryCount(BasicColumnWriterState &state) {
+	// every non-NULL value could be distinct
+	auto &column_chunk = state.row_group.columns[state.col_idx];
+	return NumericCast<idx_t>(column_chunk.meta_data.num_values) - state.null_count;
+}
+
 idx_t BasicColumnWriter::GetRowSize(const Vector &vector, const idx_t index,
                                     const BasicColumnWriterState &state) const {
 	throw InternalException("GetRowSize unsupported for struct/list column writers");
@@ -636,6 +659,9 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 
 		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
 		            offset + write_count);
+		if (state.bloom_filter) {
+			UpdateBloomFilter(state, vector, offset, offset + write_count);
+		}
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -728,6 +754,29 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	column_chunk.meta_data.total_compressed_size =
 	    UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten() - start_offset);
 	column_chunk.meta_data.total_uncompressed_size = UnsafeNumericCast<int64_t>(total_uncompressed_size);
+
+	if (state.bloom_filter) {
+		WriteBloomFilter(state, column_chunk);
+	}
+}
+
+void BasicColumnWriter::WriteBloomFilter(BasicColumnWriterState &state,
+                                         duckdb_parquet::format::ColumnChunk &column_chunk) {
+	// the Bloom filter is written directly after the pages of the column chunk
+	// it is not part of the column chunk itself, so it does not count towards total_compressed_size
+	auto &column_writer = writer.GetWriter();
+	auto bloom_filter_offset = column_writer.GetTotalWritten();
+
+	auto &bloom_filter = *state.bloom_filter;
+	ParquetBloomFilterHeader header;
+	header.num_bytes = NumericCast<int32_t>(bloom_filter.SizeInBytes());
+	writer.Write(header);
+	writer.WriteData(bloom_filter.Data(), NumericCast<uint32_t>(bloom_filter.SizeInBytes()));
+
+	column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(bloom_filter_offset));
+	column_chunk.meta_data.__set_bloom_filter_length(
+	    NumericCast<int32_t>(column_writer.GetTotalWritten() - bloom_filter_offset));
+	state.bloom_filter.reset();
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -920,6 +969,17 @@ public:
 		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
 	}
 
+	void UpdateBloomFilter(BasicColumnWriterState &state, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &mask = FlatVector::Validity(input_column);
+		const auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				state.bloom_filter->FilterInsert(ParquetBloomFilter::Hash(OP::template Operation<SRC, TGT>(ptr[r])));
+			}
+		}
+	}
+
 	idx_t GetRowSize(const Vector &vector, const idx_t index, const BasicColumnWriterState &state) const override {
 		return sizeof(TGT);
 	}
@@ -1497,6 +1557,31 @@ public:
 		return state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : Encoding::PLAIN;
 	}
 
+	void UpdateBloomFilter(BasicColumnWriterState &state_p, Vector &input_column, idx_t chunk_start,
+	                       idx_t chunk_end) override {
+		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (state.IsDictionaryEncoded()) {
+			// the dictionary values are inserted when flushing the dictionary
+			return;
+		}
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				state.bloom_filter->FilterInsert(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+			}
+		}
+	}
+
+	idx_t BloomFilterEntryCount(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (state.IsDictionaryEncoded()) {
+			return state.dictionary.size();
+		}
+		return BasicColumnWriter::BloomFilterEntryCount(state);
+	}
+
 	bool HasDictionary(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
 		return state.IsDictionaryEncoded();
@@ -1527,6 +1612,10 @@ public:
 			auto &value = values[r];
 			// update the statistics
 			stats.Update(value);
+			if (state.bloom_filter) {
+				state.bloom_filter->FilterInsert(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(value.GetData()), value.GetSize()));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData(const_data_ptr_cast((value.GetData())), value.GetSize());
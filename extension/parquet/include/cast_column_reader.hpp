@@ -26,6 +26,8 @@ public:
 
 public:
 	unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns) override;
+	unique_ptr<BaseStatistics> PageStats(const duckdb_parquet::format::Statistics &page_stats) override;
+	void SetPageLocations(vector<duckdb_parquet::format::PageLocation> page_locations_p) override;
 	void InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns, TProtocol &protocol_p) override;
 
 	idx_t Read(uint64_t num_values, parquet_filter_t &filter, data_ptr_t define_out, data_ptr_t repeat_out,
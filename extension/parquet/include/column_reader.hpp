@@ -69,6 +69,10 @@ public:
 	virtual void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge);
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
+	//! Statistics of a single page of the current column chunk, as stored in the page index
+	virtual unique_ptr<BaseStatistics> PageStats(const duckdb_parquet::format::Statistics &page_stats);
+	//! Set the locations of the pages in the current column chunk, which allows Skip() to jump over entire pages
+	virtual void SetPageLocations(vector<duckdb_parquet::format::PageLocation> page_locations_p);
 
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
@@ -166,6 +170,8 @@ private:
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
+	//! Jump over the pages that are skipped entirely, returns the number of values that still have to be skipped
+	idx_t SkipPages(idx_t num_values);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
 
@@ -175,6 +181,8 @@ private:
 	idx_t page_rows_available;
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
+	//! The page locations of the current column chunk (if known)
+	vector<duckdb_parquet::format::PageLocation> page_locations;
 
 	shared_ptr<ResizeableBuffer> block;
 
@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/allocator.hpp"
+#endif
+#include "parquet_types.h"
+
+namespace duckdb {
+
+//! The header that precedes the bitset of a Bloom filter in a Parquet file
+//! The generated Thrift code does not contain this struct, we only support the split-block algorithm with XXH64 hashing
+//! and no compression, which is the only combination allowed by the Parquet specification
+class ParquetBloomFilterHeader : public duckdb_apache::thrift::TBase {
+public:
+	int32_t num_bytes = 0;
+	bool is_supported = false;
+
+public:
+	uint32_t read(duckdb_apache::thrift::protocol::TProtocol *iprot) override;
+	uint32_t write(duckdb_apache::thrift::protocol::TProtocol *oprot) const override;
+};
+
+//! Split-block Bloom filter (SBBF) as defined by the Parquet specification
+//! The filter consists of 256-bit blocks, every inserted hash sets one bit in each of the eight 32-bit words of a block
+class ParquetBloomFilter {
+public:
+	static constexpr const idx_t BYTES_PER_BLOCK = 32;
+	static constexpr const idx_t WORDS_PER_BLOCK = 8;
+	//! The minimum and maximum size of the bitset, the maximum matches the one used by parquet-cpp
+	static constexpr const idx_t MINIMUM_BYTES = BYTES_PER_BLOCK;
+	static constexpr const idx_t MAXIMUM_BYTES = 128 * 1024 * 1024;
+
+public:
+	//! Create an empty filter sized for the given number of distinct values and false positive ratio
+	ParquetBloomFilter(Allocator &allocator, idx_t num_entries, double false_positive_ratio);
+	//! Create a filter from a bitset read from a file
+	explicit ParquetBloomFilter(AllocatedData data);
+
+public:
+	void FilterInsert(uint64_t hash);
+	bool FilterCheck(uint64_t hash) const;
+
+	const_data_ptr_t Data() const {
+		return data.get();
+	}
+	idx_t SizeInBytes() const {
+		return data.GetSize();
+	}
+
+	//! Hash the plain-encoded value of a column (without the length prefix for BYTE_ARRAY)
+	static uint64_t Hash(const_data_ptr_t value, idx_t size);
+	template <class T>
+	static uint64_t Hash(T value) {
+		return Hash(const_data_ptr_cast(&value), sizeof(T));
+	}
+	//! The size of the bitset in bytes for the given number of distinct values and false positive ratio
+	static idx_t OptimalNumberOfBytes(idx_t num_entries, double false_positive_ratio);
+
+private:
+	AllocatedData data;
+	idx_t block_count;
+};
+
+} // namespace duckdb
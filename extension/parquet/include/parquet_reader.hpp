@@ -64,6 +64,14 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! The row ranges [start, end) of the current row group that can contain matches according to the page index
+	//! Empty if the page index did not allow skipping any pages
+	vector<pair<idx_t, idx_t>> row_ranges;
+	//! The current entry in row_ranges
+	idx_t row_range_idx = 0;
+	//! The page locations of the columns of the current row group (empty if not known)
+	vector<vector<duckdb_parquet::format::PageLocation>> page_locations;
 };
 
 struct ParquetColumnDefinition {
@@ -209,6 +217,14 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Whether or not the Bloom filter of the column chunk shows that no row in the row group can match the filter
+	bool BloomFilterExcludes(ParquetReaderScanState &state, ColumnReader &column_reader, const TableFilter &filter);
+	//! Use the page index of the current row group to find the row ranges that can contain matches
+	void PreparePageIndex(ParquetReaderScanState &state);
+	void ReadPageIndex(ParquetReaderScanState &state, int64_t offset, int32_t length,
+	                   duckdb_apache::thrift::TBase &object);
+	//! Skip to the next row range that can contain matches, returns false if we are already inside one
+	bool SkipPrunedRows(ParquetReaderScanState &state);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -67,7 +67,8 @@ public:
 	              vector<string> names, duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level, bool debug_use_openssl);
+	              optional_idx compression_level, bool debug_use_openssl, case_insensitive_set_t bloom_filter_columns,
+	              double bloom_filter_false_positive_ratio);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -103,6 +104,13 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	//! Whether or not a Bloom filter should be written for the (top-level) column with the given name
+	bool HasBloomFilter(const string &column_name) const {
+		return bloom_filter_columns.find(column_name) != bloom_filter_columns.end();
+	}
+	double BloomFilterFalsePositiveRatio() const {
+		return bloom_filter_false_positive_ratio;
+	}
 	idx_t NumberOfRowGroups() {
 		lock_guard<mutex> glock(lock);
 		return file_meta_data.row_groups.size();
@@ -115,6 +123,8 @@ public:
 
 	static bool TryGetParquetType(const LogicalType &duckdb_type,
 	                              optional_ptr<duckdb_parquet::format::Type::type> type = nullptr);
+	//! Whether or not we can write a Bloom filter for a column of the given type
+	static bool SupportsBloomFilter(const LogicalType &duckdb_type);
 
 private:
 	string file_name;
@@ -127,6 +137,8 @@ private:
 	optional_idx compression_level;
 	bool debug_use_openssl;
 	shared_ptr<EncryptionUtil> encryption_util;
+	case_insensitive_set_t bloom_filter_columns;
+	double bloom_filter_false_positive_ratio;
 
 	unique_ptr<BufferedFileWriter> writer;
 	std::shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
@@ -0,0 +1,167 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+
+#include <cmath>
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TProtocol;
+using duckdb_apache::thrift::protocol::TType;
+
+//===--------------------------------------------------------------------===//
+// ParquetBloomFilterHeader
+//===--------------------------------------------------------------------===//
+// struct BloomFilterHeader {
+//   1: required i32 numBytes;
+//   2: required BloomFilterAlgorithm algorithm;     (union, 1: SplitBlockAlgorithm BLOCK)
+//   3: required BloomFilterHash hash;               (union, 1: XxHash XXHASH)
+//   4: required BloomFilterCompression compression; (union, 1: Uncompressed UNCOMPRESSED)
+// }
+static uint32_t ReadUnion(TProtocol &iprot, bool &has_first_member) {
+	uint32_t xfer = 0;
+	std::string name;
+	TType ftype;
+	int16_t fid;
+	has_first_member = false;
+	xfer += iprot.readStructBegin(name);
+	while (true) {
+		xfer += iprot.readFieldBegin(name, ftype, fid);
+		if (ftype == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		if (fid == 1 && ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+			has_first_member = true;
+		}
+		xfer += iprot.skip(ftype);
+		xfer += iprot.readFieldEnd();
+	}
+	xfer += iprot.readStructEnd();
+	return xfer;
+}
+
+static uint32_t WriteUnion(TProtocol &oprot, const char *field_name, int16_t field_id, const char *member_name) {
+	uint32_t xfer = 0;
+	xfer += oprot.writeFieldBegin(field_name, duckdb_apache::thrift::protocol::T_STRUCT, field_id);
+	xfer += oprot.writeStructBegin(field_name);
+	xfer += oprot.writeFieldBegin(member_name, duckdb_apache::thrift::protocol::T_STRUCT, 1);
+	xfer += oprot.writeStructBegin(member_name);
+	xfer += oprot.writeFieldStop();
+	xfer += oprot.writeStructEnd();
+	xfer += oprot.writeFieldEnd();
+	xfer += oprot.writeFieldStop();
+	xfer += oprot.writeStructEnd();
+	xfer += oprot.writeFieldEnd();
+	return xfer;
+}
+
+uint32_t ParquetBloomFilterHeader::read(TProtocol *iprot) {
+	duckdb_apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+	uint32_t xfer = 0;
+	std::string name;
+	TType ftype;
+	int16_t fid;
+
+	bool has_num_bytes = false;
+	bool is_block = false;
+	bool is_xxhash = false;
+	bool is_uncompressed = false;
+	xfer += iprot->readStructBegin(name);
+	while (true) {
+		xfer += iprot->readFieldBegin(name, ftype, fid);
+		if (ftype == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		if (fid == 1 && ftype == duckdb_apache::thrift::protocol::T_I32) {
+			xfer += iprot->readI32(num_bytes);
+			has_num_bytes = true;
+		} else if (fid == 2 && ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+			xfer += ReadUnion(*iprot, is_block);
+		} else if (fid == 3 && ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+			xfer += ReadUnion(*iprot, is_xxhash);
+		} else if (fid == 4 && ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+			xfer += ReadUnion(*iprot, is_uncompressed);
+		} else {
+			xfer += iprot->skip(ftype);
+		}
+		xfer += iprot->readFieldEnd();
+	}
+	xfer += iprot->readStructEnd();
+
+	is_supported = has_num_bytes && is_block && is_xxhash && is_uncompressed && num_bytes > 0 &&
+	               idx_t(num_bytes) % ParquetBloomFilter::BYTES_PER_BLOCK == 0 &&
+	               idx_t(num_bytes) <= ParquetBloomFilter::MAXIMUM_BYTES;
+	return xfer;
+}
+
+uint32_t ParquetBloomFilterHeader::write(TProtocol *oprot) const {
+	duckdb_apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+	uint32_t xfer = 0;
+	xfer += oprot->writeStructBegin("BloomFilterHeader");
+	xfer += oprot->writeFieldBegin("numBytes", duckdb_apache::thrift::protocol::T_I32, 1);
+	xfer += oprot->writeI32(num_bytes);
+	xfer += oprot->writeFieldEnd();
+	xfer += WriteUnion(*oprot, "algorithm", 2, "BLOCK");
+	xfer += WriteUnion(*oprot, "hash", 3, "XXHASH");
+	xfer += WriteUnion(*oprot, "compression", 4, "UNCOMPRESSED");
+	xfer += oprot->writeFieldStop();
+	xfer += oprot->writeStructEnd();
+	return xfer;
+}
+
+//===--------------------------------------------------------------------===//
+// ParquetBloomFilter
+//===--------------------------------------------------------------------===//
+static constexpr const uint32_t BLOOM_FILTER_SALT[ParquetBloomFilter::WORDS_PER_BLOCK] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(Allocator &allocator, idx_t num_entries, double false_positive_ratio) {
+	auto num_bytes = OptimalNumberOfBytes(num_entries, false_positive_ratio);
+	data = allocator.Allocate(num_bytes);
+	memset(data.get(), 0, num_bytes);
+	block_count = num_bytes / BYTES_PER_BLOCK;
+}
+
+ParquetBloomFilter::ParquetBloomFilter(AllocatedData data_p) : data(std::move(data_p)) {
+	D_ASSERT(data.GetSize() % BYTES_PER_BLOCK == 0);
+	block_count = data.GetSize() / BYTES_PER_BLOCK;
+}
+
+idx_t ParquetBloomFilter::OptimalNumberOfBytes(idx_t num_entries, double false_positive_ratio) {
+	// the number of bits from the Parquet specification: -8 * ndv / ln(1 - fpp^(1/8))
+	auto num_bits = -8.0 * static_cast<double>(MaxValue<idx_t>(num_entries, 1)) /
+	                std::log(1.0 - std::pow(false_positive_ratio, 1.0 / 8.0));
+	if (!(num_bits < static_cast<double>(MAXIMUM_BYTES * 8))) {
+		return MAXIMUM_BYTES;
+	}
+	auto num_bytes = NextPowerOfTwo(static_cast<idx_t>(std::ceil(num_bits / 8.0)));
+	return MinValue<idx_t>(MaxValue<idx_t>(num_bytes, MINIMUM_BYTES), MAXIMUM_BYTES);
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t value, idx_t size) {
+	return duckdb_zstd::XXH64(value, size, 0);
+}
+
+void ParquetBloomFilter::FilterInsert(uint64_t hash) {
+	// the upper 32 bits select the block, the lower 32 bits select one bit in every word of the block
+	auto block_idx = ((hash >> 32) * block_count) >> 32;
+	auto key = static_cast<uint32_t>(hash);
+	auto block = reinterpret_cast<uint32_t *>(data.get()) + block_idx * WORDS_PER_BLOCK;
+	for (idx_t word_idx = 0; word_idx < WORDS_PER_BLOCK; word_idx++) {
+		block[word_idx] |= 1U << ((key * BLOOM_FILTER_SALT[word_idx]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	auto block_idx = ((hash >> 32) * block_count) >> 32;
+	auto key = static_cast<uint32_t>(hash);
+	auto block = reinterpret_cast<const uint32_t *>(data.get()) + block_idx * WORDS_PER_BLOCK;
+	for (idx_t word_idx = 0; word_idx < WORDS_PER_BLOCK; word_idx++) {
+		if (!(block[word_idx] & (1U << ((key * BLOOM_FILTER_SALT[word_idx]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace duckdb
@@ -25,6 +25,7 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/catalog_entry/table_function_catalog_entry.hpp"
+#include "duckdb/common/bind_helpers.hpp"
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/enums/file_compression_type.hpp"
 #include "duckdb/common/file_system.hpp"
@@ -201,6 +202,11 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+
+	//! The columns for which a Bloom filter is written
+	vector<string> bloom_filter_columns;
+	//! The false positive ratio the Bloom filters are sized for
+	double bloom_filter_false_positive_ratio = 0.01;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -1180,8 +1186,24 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 	auto bind_data = make_uniq<ParquetWriteBindData>();
 	for (auto &option : input.info.options) {
 		const auto loption = StringUtil::Lower(option.first);
+		if (loption == "bloom_filter_columns") {
+			// this is the only option that takes a list of columns
+			auto column_names = names;
+			auto bloom_filter_columns = ParseColumnList(ConvertVectorToValue(option.second), column_names, loption);
+			for (idx_t col_idx = 0; col_idx < names.size(); col_idx++) {
+				if (!bloom_filter_columns[col_idx]) {
+					continue;
+				}
+				if (!ParquetWriter::SupportsBloomFilter(sql_types[col_idx])) {
+					throw BinderException("BLOOM_FILTER_COLUMNS: cannot write a Bloom filter for column \"%s\" of type %s",
+					                      names[col_idx], sql_types[col_idx].ToString());
+				}
+				bind_data->bloom_filter_columns.push_back(names[col_idx]);
+			}
+			continue;
+		}
 		if (option.second.size() != 1) {
-			// All parquet write options require exactly one argument
+			// All other parquet write options require exactly one argument
 			throw BinderException("%s requires exactly one argument", StringUtil::Upper(loption));
 		}
 		if (loption == "row_group_size" || loption == "chunk_size") {
@@ -1273,10 +1295,19 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "bloom_filter_false_positive_ratio") {
+			auto val = option.second[0].GetValue<double>();
+			if (!(val > 0 && val < 1)) {
+				throw BinderException("bloom_filter_false_positive_ratio must be between 0 and 1 (exclusive)");
+			}
+			bind_data->bloom_filter_false_positive_ratio = val;
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
 	}
+	if (!bind_data->bloom_filter_columns.empty() && bind_data->encryption_config) {
+		throw BinderException("BLOOM_FILTER_COLUMNS cannot be combined with ENCRYPTION_CONFIG");
+	}
 	if (row_group_size_bytes_set) {
 		if (DBConfig::GetConfig(context).options.preserve_insertion_order) {
 			throw BinderException("ROW_GROUP_SIZE_BYTES does not work while preserving insertion order. Use \"SET "
@@ -1302,7 +1333,10 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	    make_uniq<ParquetWriter>(context, fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                             parquet_bind.codec, parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata,
 	                             parquet_bind.encryption_config, parquet_bind.dictionary_compression_ratio_threshold,
-	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl);
+	                             parquet_bind.compression_level, parquet_bind.debug_use_openssl,
+	                             case_insensitive_set_t(parquet_bind.bloom_filter_columns.begin(),
+	                                                    parquet_bind.bloom_filter_columns.end()),
+	                             parquet_bind.bloom_filter_false_positive_ratio);
 	return std::move(global_state);
 }
 
@@ -1426,6 +1460,9 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
 	serializer.WriteProperty(110, "row_groups_per_file", bind_data.row_groups_per_file);
 	serializer.WriteProperty(111, "debug_use_openssl", bind_data.debug_use_openssl);
+	serializer.WritePropertyWithDefault(112, "bloom_filter_columns", bind_data.bloom_filter_columns);
+	serializer.WritePropertyWithDefault(113, "bloom_filter_false_positive_ratio",
+	                                    bind_data.bloom_filter_false_positive_ratio, 0.01);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1445,6 +1482,9 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->row_groups_per_file =
 	    deserializer.ReadPropertyWithDefault<optional_idx>(110, "row_groups_per_file", optional_idx::Invalid());
 	data->debug_use_openssl = deserializer.ReadPropertyWithDefault<bool>(111, "debug_use_openssl", true);
+	deserializer.ReadPropertyWithDefault<vector<string>>(112, "bloom_filter_columns", data->bloom_filter_columns);
+	deserializer.ReadPropertyWithDefault<double>(113, "bloom_filter_false_positive_ratio",
+	                                             data->bloom_filter_false_positive_ratio, 0.01);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -8,6 +8,7 @@
 #include "expression_column_reader.hpp"
 #include "geo_parquet.hpp"
 #include "list_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_file_metadata_cache.hpp"
 #include "parquet_statistics.hpp"
@@ -28,9 +29,11 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #endif
 
 #include <cassert>
@@ -41,10 +44,13 @@
 namespace duckdb {
 
 using duckdb_parquet::format::ColumnChunk;
+using duckdb_parquet::format::ColumnIndex;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::FileCryptoMetaData;
 using duckdb_parquet::format::FileMetaData;
+using duckdb_parquet::format::OffsetIndex;
+using duckdb_parquet::format::PageLocation;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Statistics;
@@ -712,11 +718,192 @@ static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, con
 		return StringStats::CheckZonemap(const_data_ptr_cast(min_value.c_str()), min_value.size(),
 		                                 const_data_ptr_cast(max_value.c_str()), max_value.size(),
 		                                 constant_filter.comparison_type, StringValue::Get(constant_filter.constant));
+	} else if (filter.filter_type == TableFilterType::IN_FILTER) {
+		auto &in_filter = filter.Cast<InFilter>();
+		auto &min_value = pq_col_stats.min_value;
+		auto &max_value = pq_col_stats.max_value;
+		for (auto &value : in_filter.values) {
+			auto prune_result = StringStats::CheckZonemap(
+			    const_data_ptr_cast(min_value.c_str()), min_value.size(), const_data_ptr_cast(max_value.c_str()),
+			    max_value.size(), ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+			if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
 	} else {
 		return filter.CheckStatistics(stats);
 	}
 }
 
+static FilterPropagateResult CheckParquetFilter(ColumnReader &column_reader, BaseStatistics &stats,
+                                                const Statistics &pq_col_stats, TableFilter &filter) {
+	if (column_reader.Type().id() != LogicalTypeId::VARCHAR || !pq_col_stats.__isset.min_value ||
+	    !pq_col_stats.__isset.max_value) {
+		return filter.CheckStatistics(stats);
+	}
+	// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
+	// however, when reading remote Parquet files, skipping row groups is really important
+	// here, we implement a special case to check the full length for string filters
+	if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
+		const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		for (auto &child_filter : and_filter.child_filters) {
+			auto child_prune_result = CheckParquetStringFilter(stats, pq_col_stats, *child_filter);
+			if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
+				break;
+			} else if (child_prune_result != and_result) {
+				and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return and_result;
+	}
+	return CheckParquetStringFilter(stats, pq_col_stats, filter);
+}
+
+//! Whether or not the filter contains equality comparisons that can be checked against a Bloom filter
+static bool FilterHasEqualityConstants(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return filter.Cast<ConstantFilter>().comparison_type == ExpressionType::COMPARE_EQUAL;
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (FilterHasEqualityConstants(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Hash a constant the way it is hashed when it is written to the Bloom filter, i.e., as its plain-encoded value
+//! We only do this for types where equality of the value implies equality of the plain encoding
+static bool GetBloomFilterHash(ColumnReader &column_reader, const Value &constant, uint64_t &hash) {
+	if (constant.IsNull()) {
+		return false;
+	}
+	auto physical_type = column_reader.Schema().type;
+	switch (column_reader.Type().id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+		if (physical_type != Type::INT32) {
+			return false;
+		}
+		hash = ParquetBloomFilter::Hash<int32_t>(constant.GetValue<int32_t>());
+		return true;
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+		if (physical_type != Type::INT32) {
+			return false;
+		}
+		hash = ParquetBloomFilter::Hash<uint32_t>(constant.GetValue<uint32_t>());
+		return true;
+	case LogicalTypeId::BIGINT:
+		if (physical_type != Type::INT64) {
+			return false;
+		}
+		hash = ParquetBloomFilter::Hash<int64_t>(constant.GetValue<int64_t>());
+		return true;
+	case LogicalTypeId::UBIGINT:
+		if (physical_type != Type::INT64) {
+			return false;
+		}
+		hash = ParquetBloomFilter::Hash<uint64_t>(constant.GetValue<uint64_t>());
+		return true;
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB: {
+		if (physical_type != Type::BYTE_ARRAY) {
+			return false;
+		}
+		auto &str = StringValue::Get(constant);
+		hash = ParquetBloomFilter::Hash(const_data_ptr_cast(str.c_str()), str.size());
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+static bool BloomFilterCanMatch(ColumnReader &column_reader, const ParquetBloomFilter &bloom_filter,
+                                const TableFilter &filter) {
+	uint64_t hash;
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    !GetBloomFilterHash(column_reader, constant_filter.constant, hash)) {
+			return true;
+		}
+		return bloom_filter.FilterCheck(hash);
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			if (!GetBloomFilterHash(column_reader, value, hash) || bloom_filter.FilterCheck(hash)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (!BloomFilterCanMatch(column_reader, bloom_filter, *child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return true;
+	}
+}
+
+bool ParquetReader::BloomFilterExcludes(ParquetReaderScanState &state, ColumnReader &column_reader,
+                                        const TableFilter &filter) {
+	auto &group = GetGroup(state);
+	if (parquet_options.encryption_config || !column_reader.Schema().__isset.type || column_reader.MaxRepeat() > 0 ||
+	    column_reader.FileIdx() >= group.columns.size() || !FilterHasEqualityConstants(filter)) {
+		return false;
+	}
+	auto &meta_data = group.columns[column_reader.FileIdx()].meta_data;
+	if (!meta_data.__isset.bloom_filter_offset || column_reader.Type() != DeriveLogicalType(column_reader.Schema())) {
+		// no Bloom filter, or the column is cast to a different type than the one stored in the file
+		return false;
+	}
+
+	// read the Bloom filter header and bitset
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	auto bloom_filter_offset = NumericCast<idx_t>(meta_data.bloom_filter_offset);
+	if (state.prefetch_mode && meta_data.__isset.bloom_filter_length) {
+		trans.Prefetch(bloom_filter_offset, NumericCast<idx_t>(meta_data.bloom_filter_length));
+	}
+	trans.SetLocation(bloom_filter_offset);
+	ParquetBloomFilterHeader header;
+	Read(header, *state.thrift_file_proto);
+	if (!header.is_supported) {
+		return false;
+	}
+	auto header_size = trans.GetLocation() - bloom_filter_offset;
+	if (meta_data.__isset.bloom_filter_length &&
+	    header_size + NumericCast<idx_t>(header.num_bytes) > NumericCast<idx_t>(meta_data.bloom_filter_length)) {
+		throw InvalidInputException("Malformed parquet file: Bloom filter is larger than its declared length");
+	}
+	auto data = allocator.Allocate(NumericCast<idx_t>(header.num_bytes));
+	ReadData(*state.thrift_file_proto, data.get(), NumericCast<uint32_t>(header.num_bytes));
+	ParquetBloomFilter bloom_filter(std::move(data));
+	return !BloomFilterCanMatch(column_reader, bloom_filter, filter);
+}
+
 void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t col_idx) {
 	auto &group = GetGroup(state);
 	auto column_id = reader_data.column_ids[col_idx];
@@ -732,37 +919,17 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 			bool skip_chunk = false;
 			auto &filter = *filter_entry->second;
 
-			FilterPropagateResult prune_result;
-			if (column_reader->Type().id() == LogicalTypeId::VARCHAR &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.min_value &&
-			    group.columns[column_reader->FileIdx()].meta_data.statistics.__isset.max_value) {
-				// our StringStats only store the first 8 bytes of strings (even if Parquet has longer string stats)
-				// however, when reading remote Parquet files, skipping row groups is really important
-				// here, we implement a special case to check the full length for string filters
-				if (filter.filter_type == TableFilterType::CONJUNCTION_AND) {
-					const auto &and_filter = filter.Cast<ConjunctionAndFilter>();
-					auto and_result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
-					for (auto &child_filter : and_filter.child_filters) {
-						auto child_prune_result = CheckParquetStringFilter(
-						    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, *child_filter);
-						if (child_prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
-							and_result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
-							break;
-						} else if (child_prune_result != and_result) {
-							and_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
-						}
-					}
-					prune_result = and_result;
-				} else {
-					prune_result = CheckParquetStringFilter(
-					    *stats, group.columns[column_reader->FileIdx()].meta_data.statistics, filter);
-				}
-			} else {
-				prune_result = filter.CheckStatistics(*stats);
-			}
-
+			// only leaf columns have their own column chunk (and Parquet statistics) in the row group
+			auto prune_result = column_reader->Type().id() == LogicalTypeId::VARCHAR
+			                        ? CheckParquetFilter(*column_reader, *stats,
+			                                             group.columns[column_reader->FileIdx()].meta_data.statistics,
+			                                             filter)
+			                        : filter.CheckStatistics(*stats);
 			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
 				skip_chunk = true;
+			} else if (state.group_offset < NumericCast<idx_t>(group.num_rows)) {
+				// probe the Bloom filter (if any) before we fetch any data of the row group
+				skip_chunk = BloomFilterExcludes(state, *column_reader, filter);
 			}
 			if (skip_chunk) {
 				// this effectively will skip this chunk
@@ -776,6 +943,252 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+//! Whether or not a filter can only be satisfied by non-NULL values
+static bool FilterRejectsNulls(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (FilterRejectsNulls(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!FilterRejectsNulls(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+static bool PageCanMatch(ColumnReader &column_reader, const ColumnIndex &column_index, idx_t page_idx,
+                         TableFilter &filter) {
+	if (column_index.null_pages[page_idx]) {
+		// the page only contains NULL values
+		return !FilterRejectsNulls(filter);
+	}
+	Statistics page_stats;
+	page_stats.min_value = column_index.min_values[page_idx];
+	page_stats.__isset.min_value = true;
+	page_stats.max_value = column_index.max_values[page_idx];
+	page_stats.__isset.max_value = true;
+	if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+		page_stats.null_count = column_index.null_counts[page_idx];
+		page_stats.__isset.null_count = true;
+	}
+	auto stats = column_reader.PageStats(page_stats);
+	if (!stats) {
+		return true;
+	}
+	return CheckParquetFilter(column_reader, *stats, page_stats, filter) != FilterPropagateResult::FILTER_ALWAYS_FALSE;
+}
+
+static bool PageLocationsAreValid(const vector<PageLocation> &page_locations, idx_t row_count) {
+	if (page_locations.empty() || page_locations[0].first_row_index != 0) {
+		return false;
+	}
+	for (idx_t page_idx = 1; page_idx < page_locations.size(); page_idx++) {
+		if (page_locations[page_idx].first_row_index <= page_locations[page_idx - 1].first_row_index ||
+		    page_locations[page_idx].offset <= page_locations[page_idx - 1].offset) {
+			return false;
+		}
+	}
+	return NumericCast<idx_t>(page_locations.back().first_row_index) < row_count;
+}
+
+static vector<pair<idx_t, idx_t>> IntersectRowRanges(const vector<pair<idx_t, idx_t>> &left,
+                                                     const vector<pair<idx_t, idx_t>> &right) {
+	vector<pair<idx_t, idx_t>> result;
+	idx_t left_idx = 0;
+	idx_t right_idx = 0;
+	while (left_idx < left.size() && right_idx < right.size()) {
+		auto start = MaxValue(left[left_idx].first, right[right_idx].first);
+		auto end = MinValue(left[left_idx].second, right[right_idx].second);
+		if (start < end) {
+			result.emplace_back(start, end);
+		}
+		if (left[left_idx].second < right[right_idx].second) {
+			left_idx++;
+		} else {
+			right_idx++;
+		}
+	}
+	return result;
+}
+
+void ParquetReader::ReadPageIndex(ParquetReaderScanState &state, int64_t offset, int32_t length,
+                                  duckdb_apache::thrift::TBase &object) {
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	if (state.prefetch_mode) {
+		trans.Prefetch(NumericCast<idx_t>(offset), NumericCast<idx_t>(length));
+	}
+	trans.SetLocation(NumericCast<idx_t>(offset));
+	Read(object, *state.thrift_file_proto);
+}
+
+static void RegisterPagePrefetch(ThriftFileTransport &transport, ColumnReader &column_reader,
+                                 const vector<PageLocation> &page_locations,
+                                 const vector<pair<idx_t, idx_t>> &row_ranges, idx_t row_count, bool allow_merge) {
+	// any dictionary page precedes the first data page
+	auto chunk_start = column_reader.FileOffset();
+	auto first_page_offset = NumericCast<idx_t>(page_locations[0].offset);
+	if (chunk_start < first_page_offset) {
+		transport.RegisterPrefetch(chunk_start, first_page_offset - chunk_start, allow_merge);
+	}
+	idx_t range_idx = 0;
+	for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+		auto &page = page_locations[page_idx];
+		auto page_start = NumericCast<idx_t>(page.first_row_index);
+		auto page_end =
+		    page_idx + 1 < page_locations.size() ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+		                                         : row_count;
+		while (range_idx < row_ranges.size() && row_ranges[range_idx].second <= page_start) {
+			range_idx++;
+		}
+		if (range_idx == row_ranges.size()) {
+			break;
+		}
+		if (row_ranges[range_idx].first < page_end) {
+			transport.RegisterPrefetch(NumericCast<idx_t>(page.offset), NumericCast<idx_t>(page.compressed_page_size),
+			                           allow_merge);
+		}
+	}
+}
+
+void ParquetReader::PreparePageIndex(ParquetReaderScanState &state) {
+	state.row_ranges.clear();
+	state.row_range_idx = 0;
+	state.page_locations.clear();
+
+	auto &group = GetGroup(state);
+	const auto row_count = NumericCast<idx_t>(group.num_rows);
+	if (!reader_data.filters || state.group_offset >= row_count || parquet_options.encryption_config) {
+		// either there is nothing to prune, or the row group was already pruned entirely
+		return;
+	}
+
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	// the page index is only used for (non-nested) leaf columns
+	auto get_page_index_chunk = [&](ColumnReader &column_reader) -> optional_ptr<const ColumnChunk> {
+		if (!column_reader.Schema().__isset.type || column_reader.MaxRepeat() > 0 ||
+		    column_reader.FileIdx() >= group.columns.size()) {
+			return nullptr;
+		}
+		auto &chunk = group.columns[column_reader.FileIdx()];
+		if (!chunk.__isset.offset_index_offset || !chunk.__isset.offset_index_length) {
+			return nullptr;
+		}
+		return &chunk;
+	};
+
+	// find the pages of the filtered columns that can contain matches
+	state.page_locations.resize(reader_data.column_ids.size());
+	vector<pair<idx_t, idx_t>> row_ranges {{0, row_count}};
+	for (auto &filter_col : reader_data.filters->filters) {
+		auto &filter_entry = reader_data.filter_map[filter_col.first];
+		if (filter_entry.is_constant) {
+			continue;
+		}
+		auto &column_reader = *root_reader.GetChildReader(reader_data.column_ids[filter_entry.index]);
+		auto chunk = get_page_index_chunk(column_reader);
+		if (!chunk || !chunk->__isset.column_index_offset || !chunk->__isset.column_index_length) {
+			continue;
+		}
+		ColumnIndex column_index;
+		ReadPageIndex(state, chunk->column_index_offset, chunk->column_index_length, column_index);
+		OffsetIndex offset_index;
+		ReadPageIndex(state, chunk->offset_index_offset, chunk->offset_index_length, offset_index);
+
+		auto &page_locations = offset_index.page_locations;
+		const auto page_count = page_locations.size();
+		if (!PageLocationsAreValid(page_locations, row_count) || column_index.null_pages.size() != page_count ||
+		    column_index.min_values.size() != page_count || column_index.max_values.size() != page_count) {
+			continue;
+		}
+
+		vector<pair<idx_t, idx_t>> column_ranges;
+		for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+			if (!PageCanMatch(column_reader, column_index, page_idx, *filter_col.second)) {
+				continue;
+			}
+			auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+			auto page_end = page_idx + 1 < page_count
+			                    ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+			                    : row_count;
+			if (!column_ranges.empty() && column_ranges.back().second == page_start) {
+				column_ranges.back().second = page_end;
+			} else {
+				column_ranges.emplace_back(page_start, page_end);
+			}
+		}
+		row_ranges = IntersectRowRanges(row_ranges, column_ranges);
+		state.page_locations[filter_entry.index] = std::move(page_locations);
+	}
+
+	if (row_ranges.empty()) {
+		// no page can contain any matches: skip the entire row group
+		state.group_offset = row_count;
+		return;
+	}
+	if (row_ranges.size() == 1 && row_ranges[0].first == 0 && row_ranges[0].second == row_count) {
+		// nothing to skip
+		state.page_locations.clear();
+		return;
+	}
+
+	// we can skip pages: load the page locations of all the other columns so we can jump over their pages as well
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto &column_reader = *root_reader.GetChildReader(reader_data.column_ids[col_idx]);
+		auto &page_locations = state.page_locations[col_idx];
+		if (page_locations.empty()) {
+			auto chunk = get_page_index_chunk(column_reader);
+			if (!chunk) {
+				continue;
+			}
+			OffsetIndex offset_index;
+			ReadPageIndex(state, chunk->offset_index_offset, chunk->offset_index_length, offset_index);
+			if (!PageLocationsAreValid(offset_index.page_locations, row_count)) {
+				continue;
+			}
+			page_locations = std::move(offset_index.page_locations);
+		}
+		column_reader.SetPageLocations(page_locations);
+	}
+	state.row_ranges = std::move(row_ranges);
+}
+
+bool ParquetReader::SkipPrunedRows(ParquetReaderScanState &state) {
+	auto &row_ranges = state.row_ranges;
+	while (state.row_range_idx < row_ranges.size() && row_ranges[state.row_range_idx].second <= state.group_offset) {
+		state.row_range_idx++;
+	}
+	auto row_count = NumericCast<idx_t>(GetGroup(state).num_rows);
+	auto skip_to = state.row_range_idx < row_ranges.size() ? row_ranges[state.row_range_idx].first : row_count;
+	if (skip_to <= state.group_offset) {
+		return false;
+	}
+	if (skip_to < row_count) {
+		auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+			root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_to - state.group_offset);
+		}
+	}
+	state.group_offset = skip_to;
+	return true;
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -852,6 +1265,25 @@ void FilterIsNotNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 	}
 }
 
+static void FilterSelection(Vector &v, const TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
+	// evaluate the filter using the selection-vector based implementation of the table scan
+	SelectionVector sel(count);
+	idx_t approved_tuple_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(approved_tuple_count++, i);
+		}
+	}
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	ColumnSegment::FilterSelection(sel, v, vdata, filter, count, approved_tuple_count);
+
+	filter_mask.reset();
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 template <class T, class OP>
 void TemplatedFilterOperation(Vector &v, T constant, parquet_filter_t &filter_mask, idx_t count) {
 	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
@@ -994,6 +1426,10 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::IN_FILTER:
+	case TableFilterType::BLOOM_FILTER:
+		FilterSelection(v, filter, filter_mask, count);
+		break;
 	default:
 		D_ASSERT(0);
 		break;
@@ -1037,6 +1473,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
+		PreparePageIndex(state);
 
 		auto &group = GetGroup(state);
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
@@ -1075,7 +1512,15 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 						auto entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
 						has_filter = entry != reader_data.filters->filters.end();
 					}
-					root_reader.GetChildReader(file_col_idx)->RegisterPrefetch(trans, !(lazy_fetch && !has_filter));
+					auto column_reader = root_reader.GetChildReader(file_col_idx);
+					bool allow_merge = !(lazy_fetch && !has_filter);
+					if (!state.row_ranges.empty() && !state.page_locations[col_idx].empty()) {
+						// only fetch the dictionary and the pages that overlap with the remaining row ranges
+						RegisterPagePrefetch(trans, *column_reader, state.page_locations[col_idx], state.row_ranges,
+						                     NumericCast<idx_t>(group.num_rows), allow_merge);
+						continue;
+					}
+					column_reader->RegisterPrefetch(trans, allow_merge);
 				}
 
 				trans.FinalizeRegistration();
@@ -1088,6 +1533,12 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
+	if (!state.row_ranges.empty() && SkipPrunedRows(state)) {
+		// we skipped over pages that cannot contain any matches
+		result.SetCardinality(0);
+		return true;
+	}
+
 	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
@@ -198,6 +198,9 @@ unique_ptr<CatalogEntry> DuckTableEntry::AlterEntry(ClientContext &context, Alte
 		throw CatalogException("Can only modify table with ALTER TABLE statement");
 	}
 	auto &table_info = info.Cast<AlterTableInfo>();
+	if (IsMaterializedView() && table_info.alter_table_type != AlterTableType::RENAME_TABLE) {
+		throw CatalogException("Cannot alter materialized view \"%s\", only renaming it is supported", name);
+	}
 	switch (table_info.alter_table_type) {
 	case AlterTableType::RENAME_COLUMN: {
 		auto &rename_info = table_info.Cast<RenameColumnInfo>();
@@ -542,6 +545,11 @@ unique_ptr<CatalogEntry> DuckTableEntry::SetDefault(ClientContext &context, SetD
 		auto constraint = constraints[i]->Copy();
 		create_info->constraints.push_back(std::move(constraint));
 	}
+	if (materialized_view_query) {
+		create_info->materialized_view_query =
+		    unique_ptr_cast<SQLStatement, SelectStatement>(materialized_view_query->Copy());
+		create_info->dependencies = dependencies;
+	}
 
 	auto binder = Binder::CreateBinder(context);
 	auto bound_create_info = binder->BindCreateTableInfo(std::move(create_info), schema);
@@ -724,6 +732,11 @@ unique_ptr<CatalogEntry> DuckTableEntry::SetColumnComment(ClientContext &context
 		auto constraint = constraints[i]->Copy();
 		create_info->constraints.push_back(std::move(constraint));
 	}
+	if (materialized_view_query) {
+		create_info->materialized_view_query =
+		    unique_ptr_cast<SQLStatement, SelectStatement>(materialized_view_query->Copy());
+		create_info->dependencies = dependencies;
+	}
 
 	auto binder = Binder::CreateBinder(context);
 	auto bound_create_info = binder->BindCreateTableInfo(std::move(create_info), schema);
@@ -797,6 +810,11 @@ unique_ptr<CatalogEntry> DuckTableEntry::Copy(ClientContext &context) const {
 		auto constraint = constraints[i]->Copy();
 		create_info->constraints.push_back(std::move(constraint));
 	}
+	if (materialized_view_query) {
+		create_info->materialized_view_query =
+		    unique_ptr_cast<SQLStatement, SelectStatement>(materialized_view_query->Copy());
+		create_info->dependencies = dependencies;
+	}
 
 	auto binder = Binder::CreateBinder(context);
 	auto bound_create_info = binder->BindCreateTableInfo(std::move(create_info), schema);
@@ -21,13 +21,20 @@ namespace duckdb {
 
 TableCatalogEntry::TableCatalogEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info)
     : StandardEntry(CatalogType::TABLE_ENTRY, schema, catalog, info.table), columns(std::move(info.columns)),
-      constraints(std::move(info.constraints)) {
+      constraints(std::move(info.constraints)), materialized_view_query(std::move(info.materialized_view_query)) {
 	this->temporary = info.temporary;
 	this->dependencies = info.dependencies;
 	this->comment = info.comment;
 	this->tags = info.tags;
 }
 
+const SelectStatement &TableCatalogEntry::GetMaterializedViewQuery() const {
+	if (!materialized_view_query) {
+		throw InternalException("Table \"%s\" is not a materialized view", name);
+	}
+	return *materialized_view_query;
+}
+
 bool TableCatalogEntry::HasGeneratedColumns() const {
 	return columns.LogicalColumnCount() != columns.PhysicalColumnCount();
 }
@@ -69,6 +76,10 @@ unique_ptr<CreateInfo> TableCatalogEntry::GetInfo() const {
 	result->dependencies = dependencies;
 	std::for_each(constraints.begin(), constraints.end(),
 	              [&result](const unique_ptr<Constraint> &c) { result->constraints.emplace_back(c->Copy()); });
+	if (materialized_view_query) {
+		result->materialized_view_query =
+		    unique_ptr_cast<SQLStatement, SelectStatement>(materialized_view_query->Copy());
+	}
 	result->comment = comment;
 	result->tags = tags;
 	return std::move(result);
@@ -568,6 +568,18 @@ void DependencyManager::AlterObject(CatalogTransaction transaction, CatalogEntry
 	}
 }
 
+void DependencyManager::ScanDependentEntries(CatalogTransaction transaction, CatalogEntry &entry,
+                                             const std::function<void(CatalogEntry &)> &callback) {
+	auto info = GetLookupProperties(entry);
+	ScanDependents(transaction, info, [&](DependencyEntry &dependent) {
+		auto dep = LookupEntry(transaction, dependent);
+		if (!dep) {
+			return;
+		}
+		callback(*dep);
+	});
+}
+
 void DependencyManager::Scan(
     ClientContext &context,
     const std::function<void(CatalogEntry &, CatalogEntry &, const DependencyDependentFlags &)> &callback) {
@@ -4327,6 +4327,24 @@ const char* EnumUtil::ToChars<MetricsType>(MetricsType value) {
 		return "OPERATOR_ROWS_SCANNED";
 	case MetricsType::OPERATOR_TIMING:
 		return "OPERATOR_TIMING";
+	case MetricsType::OPERATOR_PEAK_MEMORY:
+		return "OPERATOR_PEAK_MEMORY";
+	case MetricsType::OPERATOR_TEMP_BYTES_WRITTEN:
+		return "OPERATOR_TEMP_BYTES_WRITTEN";
+	case MetricsType::OPERATOR_TEMP_BYTES_READ:
+		return "OPERATOR_TEMP_BYTES_READ";
+	case MetricsType::OPERATOR_STORAGE_BYTES_READ:
+		return "OPERATOR_STORAGE_BYTES_READ";
+	case MetricsType::OPERATOR_BUFFER_HIT_RATIO:
+		return "OPERATOR_BUFFER_HIT_RATIO";
+	case MetricsType::OPERATOR_CPU_CYCLES:
+		return "OPERATOR_CPU_CYCLES";
+	case MetricsType::OPERATOR_INSTRUCTIONS:
+		return "OPERATOR_INSTRUCTIONS";
+	case MetricsType::OPERATOR_LLC_MISSES:
+		return "OPERATOR_LLC_MISSES";
+	case MetricsType::OPERATOR_BRANCH_MISSES:
+		return "OPERATOR_BRANCH_MISSES";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -4355,6 +4373,33 @@ MetricsType EnumUtil::FromString<MetricsType>(const char *value) {
 	if (StringUtil::Equals(value, "OPERATOR_TIMING")) {
 		return MetricsType::OPERATOR_TIMING;
 	}
+	if (StringUtil::Equals(value, "OPERATOR_PEAK_MEMORY")) {
+		return MetricsType::OPERATOR_PEAK_MEMORY;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_TEMP_BYTES_WRITTEN")) {
+		return MetricsType::OPERATOR_TEMP_BYTES_WRITTEN;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_TEMP_BYTES_READ")) {
+		return MetricsType::OPERATOR_TEMP_BYTES_READ;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_STORAGE_BYTES_READ")) {
+		return MetricsType::OPERATOR_STORAGE_BYTES_READ;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_BUFFER_HIT_RATIO")) {
+		return MetricsType::OPERATOR_BUFFER_HIT_RATIO;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_CPU_CYCLES")) {
+		return MetricsType::OPERATOR_CPU_CYCLES;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_INSTRUCTIONS")) {
+		return MetricsType::OPERATOR_INSTRUCTIONS;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_LLC_MISSES")) {
+		return MetricsType::OPERATOR_LLC_MISSES;
+	}
+	if (StringUtil::Equals(value, "OPERATOR_BRANCH_MISSES")) {
+		return MetricsType::OPERATOR_BRANCH_MISSES;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -4635,6 +4680,8 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "EXTENSION";
 	case OptimizerType::MATERIALIZED_CTE:
 		return "MATERIALIZED_CTE";
+	case OptimizerType::LATE_MATERIALIZATION:
+		return "LATE_MATERIALIZATION";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -4714,6 +4761,9 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "MATERIALIZED_CTE")) {
 		return OptimizerType::MATERIALIZED_CTE;
 	}
+	if (StringUtil::Equals(value, "LATE_MATERIALIZATION")) {
+		return OptimizerType::LATE_MATERIALIZATION;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -5158,6 +5208,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "EXPRESSION_SCAN";
 	case PhysicalOperatorType::POSITIONAL_SCAN:
 		return "POSITIONAL_SCAN";
+	case PhysicalOperatorType::RESULT_CACHE_SCAN:
+		return "RESULT_CACHE_SCAN";
 	case PhysicalOperatorType::BLOCKWISE_NL_JOIN:
 		return "BLOCKWISE_NL_JOIN";
 	case PhysicalOperatorType::NESTED_LOOP_JOIN:
@@ -5178,6 +5230,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "POSITIONAL_JOIN";
 	case PhysicalOperatorType::ASOF_JOIN:
 		return "ASOF_JOIN";
+	case PhysicalOperatorType::INDEX_JOIN:
+		return "INDEX_JOIN";
 	case PhysicalOperatorType::UNION:
 		return "UNION";
 	case PhysicalOperatorType::RECURSIVE_CTE:
@@ -5350,6 +5404,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "POSITIONAL_SCAN")) {
 		return PhysicalOperatorType::POSITIONAL_SCAN;
 	}
+	if (StringUtil::Equals(value, "RESULT_CACHE_SCAN")) {
+		return PhysicalOperatorType::RESULT_CACHE_SCAN;
+	}
 	if (StringUtil::Equals(value, "BLOCKWISE_NL_JOIN")) {
 		return PhysicalOperatorType::BLOCKWISE_NL_JOIN;
 	}
@@ -5380,6 +5437,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "ASOF_JOIN")) {
 		return PhysicalOperatorType::ASOF_JOIN;
 	}
+	if (StringUtil::Equals(value, "INDEX_JOIN")) {
+		return PhysicalOperatorType::INDEX_JOIN;
+	}
 	if (StringUtil::Equals(value, "UNION")) {
 		return PhysicalOperatorType::UNION;
 	}
@@ -7189,6 +7249,10 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::BLOOM_FILTER:
+		return "BLOOM_FILTER";
+	case TableFilterType::IN_FILTER:
+		return "IN_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -7214,6 +7278,12 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "BLOOM_FILTER")) {
+		return TableFilterType::BLOOM_FILTER;
+	}
+	if (StringUtil::Equals(value, "IN_FILTER")) {
+		return TableFilterType::IN_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -58,6 +58,19 @@ extern "C" WINBASEAPI BOOL QueryFullProcessImageNameW(HANDLE, DWORD, LPWSTR, PDW
 #include <restartmanager.h>
 #endif
 
+// io_uring is used to submit batches of reads, without depending on liburing
+#if defined(__linux__) && !defined(__EMSCRIPTEN__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+// IORING_FEAT_RW_CUR_POS was introduced together with IORING_OP_READ (Linux 5.6)
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(IORING_FEAT_RW_CUR_POS)
+#define DUCKDB_IO_URING_SUPPORTED
+#endif
+#endif
+#endif
+
 namespace duckdb {
 
 #ifndef _WIN32
@@ -460,6 +473,192 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	}
 }
 
+#ifdef DUCKDB_IO_URING_SUPPORTED
+//! IOUringQueue is a minimal io_uring submission/completion queue pair, that is used to have all reads of a batch in
+//! flight at the same time while only making a single system call per queue depth worth of reads.
+class IOUringQueue {
+public:
+	static constexpr uint32_t QUEUE_DEPTH = 64;
+
+	IOUringQueue() {
+		struct io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		ring_fd = static_cast<int>(syscall(__NR_io_uring_setup, QUEUE_DEPTH, &params));
+		if (ring_fd < 0) {
+			// not supported by the kernel, or disallowed (e.g. by seccomp in a container)
+			return;
+		}
+		sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+		cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+		single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+		if (single_mmap) {
+			sq_ring_size = MaxValue(sq_ring_size, cq_ring_size);
+			cq_ring_size = sq_ring_size;
+		}
+		sq_ring = MapRing(sq_ring_size, IORING_OFF_SQ_RING);
+		cq_ring = single_mmap ? sq_ring : MapRing(cq_ring_size, IORING_OFF_CQ_RING);
+		sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+		sqes = reinterpret_cast<struct io_uring_sqe *>(MapRing(sqes_size, IORING_OFF_SQES));
+		if (!sq_ring || !cq_ring || !sqes) {
+			return;
+		}
+		sq_head = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.head);
+		sq_tail = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.tail);
+		sq_mask = *reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.ring_mask);
+		sq_array = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.array);
+		cq_head = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.head);
+		cq_tail = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.tail);
+		cq_mask = *reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.ring_mask);
+		cqes = reinterpret_cast<struct io_uring_cqe *>(cq_ring + params.cq_off.cqes);
+		sq_entries = params.sq_entries;
+		supported = true;
+	}
+
+	~IOUringQueue() {
+		if (sqes) {
+			munmap(sqes, sqes_size);
+		}
+		if (cq_ring && !single_mmap) {
+			munmap(cq_ring, cq_ring_size);
+		}
+		if (sq_ring) {
+			munmap(sq_ring, sq_ring_size);
+		}
+		if (ring_fd >= 0) {
+			close(ring_fd);
+		}
+	}
+
+	//! Returns the queue of this thread, or nullptr if io_uring is not available
+	static optional_ptr<IOUringQueue> Get() {
+		static atomic<bool> unavailable {false};
+		static thread_local unique_ptr<IOUringQueue> queue;
+		if (unavailable) {
+			return nullptr;
+		}
+		if (!queue) {
+			queue = make_uniq<IOUringQueue>();
+		}
+		if (!queue->supported) {
+			unavailable = true;
+			return nullptr;
+		}
+		return queue.get();
+	}
+
+	//! Performs the reads, the requests that are not (fully) read by io_uring are returned in "remaining"
+	//! This does not throw while reads are in flight, as the kernel is writing to the buffers of the requests
+	void Read(int fd, const vector<FileReadRequest> &requests, vector<FileReadRequest> &remaining, int &error) {
+		idx_t submitted = 0;
+		idx_t completed = 0;
+		while (completed < requests.size()) {
+			// fill up the submission queue
+			auto tail = *sq_tail;
+			while (submitted < requests.size() && submitted - completed < sq_entries) {
+				auto &request = requests[submitted];
+				auto index = tail & sq_mask;
+				auto &sqe = sqes[index];
+				memset(&sqe, 0, sizeof(sqe));
+				sqe.opcode = IORING_OP_READ;
+				sqe.fd = fd;
+				sqe.addr = reinterpret_cast<uint64_t>(request.buffer);
+				sqe.len = UnsafeNumericCast<uint32_t>(request.nr_bytes);
+				sqe.off = request.location;
+				sqe.user_data = submitted;
+				sq_array[index] = index;
+				tail++;
+				submitted++;
+			}
+			__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+
+			// submit the entries that the kernel has not consumed yet, and wait for at least one completion
+			auto to_submit = tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+			auto result = syscall(__NR_io_uring_enter, ring_fd, to_submit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+			if (result < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+				// we cannot wait for the reads that are in flight: abort the process rather than corrupt memory
+				if (submitted - completed > to_submit) {
+					throw FatalException("io_uring_enter failed with reads in flight: %s", strerror(errno));
+				}
+				// nothing is in flight: retract the entries and read the remaining requests without io_uring
+				__atomic_store_n(sq_tail, __atomic_load_n(sq_head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+				for (idx_t i = completed; i < requests.size(); i++) {
+					remaining.push_back(requests[i]);
+				}
+				return;
+			}
+
+			// reap the completions
+			auto head = *cq_head;
+			while (head != __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+				auto &cqe = cqes[head & cq_mask];
+				auto &request = requests[cqe.user_data];
+				if (cqe.res == -EINVAL || cqe.res == -EOPNOTSUPP) {
+					// IORING_OP_READ is not supported by this kernel (or file)
+					remaining.push_back(request);
+				} else if (cqe.res < 0) {
+					error = -cqe.res;
+				} else if (UnsafeNumericCast<idx_t>(cqe.res) < request.nr_bytes) {
+					// short read: read the rest of the request without io_uring
+					auto bytes_read = UnsafeNumericCast<idx_t>(cqe.res);
+					remaining.emplace_back(static_cast<data_ptr_t>(request.buffer) + bytes_read,
+					                       request.nr_bytes - bytes_read, request.location + bytes_read);
+				}
+				head++;
+				completed++;
+			}
+			__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+		}
+	}
+
+private:
+	data_ptr_t MapRing(idx_t size, off_t offset) {
+		auto ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+		return ptr == MAP_FAILED ? nullptr : static_cast<data_ptr_t>(ptr);
+	}
+
+private:
+	int ring_fd = -1;
+	bool supported = false;
+	bool single_mmap = false;
+	uint32_t sq_entries = 0;
+
+	data_ptr_t sq_ring = nullptr;
+	idx_t sq_ring_size = 0;
+	uint32_t *sq_head = nullptr;
+	uint32_t *sq_tail = nullptr;
+	uint32_t sq_mask = 0;
+	uint32_t *sq_array = nullptr;
+	struct io_uring_sqe *sqes = nullptr;
+	idx_t sqes_size = 0;
+
+	data_ptr_t cq_ring = nullptr;
+	idx_t cq_ring_size = 0;
+	uint32_t *cq_head = nullptr;
+	uint32_t *cq_tail = nullptr;
+	uint32_t cq_mask = 0;
+	struct io_uring_cqe *cqes = nullptr;
+};
+#endif
+
+void LocalFileSystem::ReadBatch(FileHandle &handle, const vector<FileReadRequest> &requests) {
+#ifdef DUCKDB_IO_URING_SUPPORTED
+	auto queue = requests.size() > 1 ? IOUringQueue::Get() : nullptr;
+	if (queue) {
+		int fd = handle.Cast<UnixFileHandle>().fd;
+		vector<FileReadRequest> remaining;
+		int error = 0;
+		queue->Read(fd, requests, remaining, error);
+		if (error != 0) {
+			throw IOException("Could not read from file \"%s\": %s", {{"errno", std::to_string(error)}}, handle.path,
+			                  strerror(error));
+		}
+		FileSystem::ReadBatch(handle, remaining);
+		return;
+	}
+#endif
+	FileSystem::ReadBatch(handle, requests);
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	int64_t bytes_read = read(fd, buffer, UnsafeNumericCast<size_t>(nr_bytes));
@@ -899,6 +1098,10 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	}
 }
 
+void LocalFileSystem::ReadBatch(FileHandle &handle, const vector<FileReadRequest> &requests) {
+	FileSystem::ReadBatch(handle, requests);
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	HANDLE hFile = handle.Cast<WindowsFileHandle>().fd;
 	auto &pos = handle.Cast<WindowsFileHandle>().position;
@@ -131,6 +131,31 @@ static unique_ptr<RenderTreeNode> CreateNode(const ProfilingNode &op) {
 		    "%.2f", op.GetProfilingInfo().metrics.at(MetricsType::OPERATOR_TIMING).GetValue<double>());
 		result->extra_text["Timing"] = timing + "s";
 	}
+	auto &info = op.GetProfilingInfo();
+	const pair<MetricsType, const char *> byte_metrics[] = {
+	    {MetricsType::OPERATOR_PEAK_MEMORY, "Peak Memory"},
+	    {MetricsType::OPERATOR_TEMP_BYTES_WRITTEN, "Spilled"},
+	    {MetricsType::OPERATOR_TEMP_BYTES_READ, "Read From Spill"},
+	    {MetricsType::OPERATOR_STORAGE_BYTES_READ, "Storage Read"}};
+	for (auto &metric : byte_metrics) {
+		if (info.Enabled(metric.first)) {
+			auto bytes = info.metrics.at(metric.first).GetValue<idx_t>();
+			result->extra_text[metric.second] = StringUtil::BytesToHumanReadableString(bytes);
+		}
+	}
+	if (info.Enabled(MetricsType::OPERATOR_BUFFER_HIT_RATIO)) {
+		auto ratio = info.metrics.at(MetricsType::OPERATOR_BUFFER_HIT_RATIO).GetValue<double>();
+		result->extra_text["Buffer Hit Ratio"] = StringUtil::Format("%.2f%%", ratio * 100);
+	}
+	const pair<MetricsType, const char *> counter_metrics[] = {{MetricsType::OPERATOR_CPU_CYCLES, "Cycles"},
+	                                                           {MetricsType::OPERATOR_INSTRUCTIONS, "Instructions"},
+	                                                           {MetricsType::OPERATOR_LLC_MISSES, "LLC Misses"},
+	                                                           {MetricsType::OPERATOR_BRANCH_MISSES, "Branch Misses"}};
+	for (auto &metric : counter_metrics) {
+		if (info.Enabled(metric.first)) {
+			result->extra_text[metric.second] = info.GetMetricAsString(metric.first);
+		}
+	}
 	return result;
 }
 
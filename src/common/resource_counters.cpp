@@ -0,0 +1,158 @@
+#include "duckdb/common/resource_counters.hpp"
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#define DUCKDB_PERF_EVENT_SUPPORTED
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace duckdb {
+
+#ifdef DUCKDB_PERF_EVENT_SUPPORTED
+//! A group of perf_event counters that measure the current thread
+class PerfEventGroup {
+public:
+	static constexpr idx_t COUNTER_COUNT = 4;
+
+	PerfEventGroup() {
+		// cycles, instructions, cache misses (usually last-level cache misses) and branch misses
+		const uint64_t configs[COUNTER_COUNT] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+		                                         PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+		for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+			struct perf_event_attr attr;
+			memset(&attr, 0, sizeof(attr));
+			attr.type = PERF_TYPE_HARDWARE;
+			attr.size = sizeof(attr);
+			attr.config = configs[i];
+			attr.read_format = PERF_FORMAT_GROUP;
+			// only count user space, this is allowed with the default perf_event_paranoid setting
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			auto group_fd = i == 0 ? -1 : fds[0];
+			fds[i] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+			if (fds[i] < 0) {
+				// not supported (e.g. no access to the PMU in a virtual machine): close the counters we opened
+				Close();
+				return;
+			}
+		}
+		supported = true;
+	}
+	~PerfEventGroup() {
+		Close();
+	}
+
+	bool Read(ResourceCounterSnapshot &snapshot) {
+		if (!supported) {
+			return false;
+		}
+		uint64_t values[COUNTER_COUNT + 1];
+		auto bytes = read(fds[0], values, sizeof(values));
+		if (bytes != static_cast<ssize_t>(sizeof(values)) || values[0] != COUNTER_COUNT) {
+			return false;
+		}
+		snapshot.cpu_cycles = values[1];
+		snapshot.instructions = values[2];
+		snapshot.llc_misses = values[3];
+		snapshot.branch_misses = values[4];
+		return true;
+	}
+
+	bool IsSupported() const {
+		return supported;
+	}
+
+private:
+	void Close() {
+		for (idx_t i = 0; i < COUNTER_COUNT; i++) {
+			if (fds[i] >= 0) {
+				close(fds[i]);
+				fds[i] = -1;
+			}
+		}
+		supported = false;
+	}
+
+private:
+	int fds[COUNTER_COUNT] = {-1, -1, -1, -1};
+	bool supported = false;
+};
+#endif
+
+struct ThreadResourceState {
+	ResourceCounterSnapshot counters;
+	int64_t peak_memory = 0;
+#ifdef DUCKDB_PERF_EVENT_SUPPORTED
+	//! The perf_event counters are only opened when they are first requested by this thread
+	unique_ptr<PerfEventGroup> perf_events;
+
+	PerfEventGroup &GetPerfEvents() {
+		if (!perf_events) {
+			perf_events = make_uniq<PerfEventGroup>();
+		}
+		return *perf_events;
+	}
+#endif
+};
+
+static thread_local ThreadResourceState thread_resource_state;
+
+void ThreadResourceCounters::AddMemoryReserved(int64_t bytes) {
+	auto &state = thread_resource_state;
+	state.counters.memory_reserved += bytes;
+	if (state.counters.memory_reserved > state.peak_memory) {
+		state.peak_memory = state.counters.memory_reserved;
+	}
+}
+
+void ThreadResourceCounters::AddTemporaryBytesWritten(idx_t bytes) {
+	thread_resource_state.counters.temp_bytes_written += bytes;
+}
+
+void ThreadResourceCounters::AddTemporaryBytesRead(idx_t bytes) {
+	thread_resource_state.counters.temp_bytes_read += bytes;
+}
+
+void ThreadResourceCounters::AddStorageBytesRead(idx_t bytes) {
+	thread_resource_state.counters.storage_bytes_read += bytes;
+}
+
+void ThreadResourceCounters::AddBufferHit() {
+	thread_resource_state.counters.buffer_hits++;
+}
+
+void ThreadResourceCounters::AddBufferMiss() {
+	thread_resource_state.counters.buffer_misses++;
+}
+
+ResourceCounterSnapshot ThreadResourceCounters::Snapshot(bool hardware_counters) {
+	auto &state = thread_resource_state;
+	auto result = state.counters;
+#ifdef DUCKDB_PERF_EVENT_SUPPORTED
+	if (hardware_counters) {
+		state.GetPerfEvents().Read(result);
+	}
+#endif
+	return result;
+}
+
+void ThreadResourceCounters::ResetPeakMemory() {
+	auto &state = thread_resource_state;
+	state.peak_memory = state.counters.memory_reserved;
+}
+
+int64_t ThreadResourceCounters::PeakMemory() {
+	return thread_resource_state.peak_memory;
+}
+
+bool ThreadResourceCounters::HardwareCountersSupported() {
+#ifdef DUCKDB_PERF_EVENT_SUPPORTED
+	return thread_resource_state.GetPerfEvents().IsSupported();
+#else
+	return false;
+#endif
+}
+
+} // namespace duckdb
@@ -93,6 +93,7 @@ PartitionGlobalSinkState::PartitionGlobalSinkState(ClientContext &context,
 
 	memory_per_thread = PhysicalOperator::GetMaxThreadMemory(context);
 	external = ClientConfig::GetConfig(context).force_external;
+	temporary_memory_state = TemporaryMemoryManager::Get(context).Register(context);
 
 	const auto thread_pages = PreviousPowerOfTwo(memory_per_thread / (4 * buffer_manager.GetBlockAllocSize()));
 	while (max_bits < 10 && (thread_pages >> max_bits) > 1) {
@@ -127,6 +128,28 @@ bool PartitionGlobalSinkState::HasMergeTasks() const {
 	}
 }
 
+void PartitionGlobalSinkState::ReserveMergeMemory() {
+	//	Estimate the size of the data we have to sort
+	idx_t total_size = 0;
+	if (grouping_data) {
+		total_size = grouping_data->SizeInBytes();
+	} else if (!hash_groups.empty()) {
+		//	The in-memory sorted blocks do not have a heap block per data block, so estimate from the row widths
+		auto &global_sort = *hash_groups[0]->global_sort;
+		const auto row_width = global_sort.sort_layout.entry_size + global_sort.payload_layout.GetRowWidth();
+		total_size = hash_groups[0]->count * row_width;
+	}
+
+	//	If we cannot keep everything in memory, sort (and scan) the partitions externally.
+	//	This only affects the hash groups that are created from the partitions during the merge:
+	//	the single OVER(ORDER BY...) group has already been sunk in its current layout.
+	temporary_memory_state->SetRemainingSize(total_size);
+	temporary_memory_state->UpdateReservation(context);
+	if (grouping_data && temporary_memory_state->GetReservation() < total_size) {
+		external = true;
+	}
+}
+
 void PartitionGlobalSinkState::SyncPartitioning(const PartitionGlobalSinkState &other) {
 	fixed_bits = other.grouping_data ? other.grouping_data->GetRadixBits() : 0;
 
@@ -553,6 +576,8 @@ bool PartitionGlobalMergeState::TryPrepareNextStage() {
 }
 
 PartitionGlobalMergeStates::PartitionGlobalMergeStates(PartitionGlobalSinkState &sink) {
+	sink.ReserveMergeMemory();
+
 	// Schedule all the sorts for maximum thread utilisation
 	if (sink.grouping_data) {
 		auto &partitions = sink.grouping_data->GetPartitions();
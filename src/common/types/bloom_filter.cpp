@@ -0,0 +1,166 @@
+#include "duckdb/common/types/bloom_filter.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+#include <cmath>
+
+namespace duckdb {
+
+//! Odd constants used to select one bit per word from the lower 32 bits of the hash (see the Parquet specification)
+static constexpr const uint32_t BLOOM_FILTER_SALT[BloomFilter::WORDS_PER_BLOCK] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+BloomFilter::BloomFilter(idx_t block_count_p) : block_count(block_count_p) {
+	if (block_count == 0 || !IsPowerOfTwo(block_count)) {
+		throw InternalException("BloomFilter block count must be a power of two");
+	}
+	blocks = make_unsafe_uniq_array<uint32_t>(block_count * WORDS_PER_BLOCK);
+	memset(blocks.get(), 0, SizeInBytes());
+}
+
+idx_t BloomFilter::GetBlockCount(idx_t capacity, idx_t bits_per_key, idx_t max_block_count) {
+	static constexpr idx_t BITS_PER_BLOCK = BLOCK_SIZE * 8;
+	auto required_blocks = (MaxValue<idx_t>(capacity, 1) * bits_per_key + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK;
+	return MinValue<idx_t>(NextPowerOfTwo(required_blocks), max_block_count);
+}
+
+double BloomFilter::EstimatedFalsePositiveRate(idx_t key_count) const {
+	// standard Bloom filter approximation with k = WORDS_PER_BLOCK - this slightly underestimates for blocked filters
+	auto bit_count = static_cast<double>(block_count * BLOCK_SIZE * 8);
+	auto k = static_cast<double>(WORDS_PER_BLOCK);
+	return std::pow(1.0 - std::exp(-k * static_cast<double>(key_count) / bit_count), k);
+}
+
+static double BlockFalsePositiveRate(const uint32_t *block) {
+	// a probe that maps to this block is a false positive if the bit it checks is set in every word
+	double result = 1.0;
+	for (idx_t i = 0; i < BloomFilter::WORDS_PER_BLOCK; i++) {
+		idx_t set_bits = 0;
+		for (auto word = block[i]; word; word &= word - 1) {
+			set_bits++;
+		}
+		result *= static_cast<double>(set_bits) / 32.0;
+	}
+	return result;
+}
+
+double BloomFilter::FalsePositiveRate() const {
+	double result = 0;
+	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+		result += BlockFalsePositiveRate(blocks.get() + block_idx * WORDS_PER_BLOCK);
+	}
+	return result / static_cast<double>(block_count);
+}
+
+void BloomFilter::Shrink(double max_false_positive_rate) {
+	// the block index is computed as ((hash >> 32) * block_count) >> 32
+	// halving the block count therefore maps blocks 2i and 2i + 1 to block i, so we can fold them together
+	auto original_block_count = block_count;
+	uint32_t folded[WORDS_PER_BLOCK];
+	while (block_count > 1) {
+		double folded_rate = 0;
+		for (idx_t block_idx = 0; block_idx < block_count; block_idx += 2) {
+			auto left = blocks.get() + block_idx * WORDS_PER_BLOCK;
+			auto right = left + WORDS_PER_BLOCK;
+			for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+				folded[i] = left[i] | right[i];
+			}
+			folded_rate += BlockFalsePositiveRate(folded);
+		}
+		if (folded_rate / static_cast<double>(block_count / 2) > max_false_positive_rate) {
+			break;
+		}
+		for (idx_t block_idx = 0; block_idx < block_count / 2; block_idx++) {
+			auto target = blocks.get() + block_idx * WORDS_PER_BLOCK;
+			auto left = blocks.get() + 2 * block_idx * WORDS_PER_BLOCK;
+			auto right = left + WORDS_PER_BLOCK;
+			for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+				target[i] = left[i] | right[i];
+			}
+		}
+		block_count /= 2;
+	}
+	if (block_count != original_block_count) {
+		// release the memory that is no longer used
+		auto new_blocks = make_unsafe_uniq_array<uint32_t>(block_count * WORDS_PER_BLOCK);
+		memcpy(new_blocks.get(), blocks.get(), SizeInBytes());
+		blocks = std::move(new_blocks);
+	}
+}
+
+static inline void GetBlockMask(hash_t hash, uint32_t mask[]) {
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < BloomFilter::WORDS_PER_BLOCK; i++) {
+		mask[i] = uint32_t(1) << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+void BloomFilter::Insert(hash_t hash) {
+	uint32_t mask[WORDS_PER_BLOCK];
+	GetBlockMask(hash, mask);
+	auto block = GetBlock(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		block[i] |= mask[i];
+	}
+}
+
+bool BloomFilter::Contains(hash_t hash) const {
+	uint32_t mask[WORDS_PER_BLOCK];
+	GetBlockMask(hash, mask);
+	auto block = GetBlock(hash);
+	bool found = true;
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		found = found && (block[i] & mask[i]) == mask[i];
+	}
+	return found;
+}
+
+void BloomFilter::Insert(Vector &hashes, const SelectionVector &sel, idx_t count) {
+	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
+	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	for (idx_t i = 0; i < count; i++) {
+		Insert(hash_data[sel.get_index(i)]);
+	}
+}
+
+idx_t BloomFilter::Probe(Vector &hashes, const SelectionVector &sel, idx_t count, SelectionVector &result) const {
+	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
+	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		// branchless write: the index is always written, but only counted if the hash might be present
+		result.set_index(result_count, idx);
+		result_count += Contains(hash_data[idx]);
+	}
+	return result_count;
+}
+
+void BloomFilter::Merge(const BloomFilter &other) {
+	if (other.block_count != block_count) {
+		throw InternalException("Cannot merge Bloom filters of different sizes");
+	}
+	auto other_blocks = other.blocks.get();
+	for (idx_t i = 0; i < block_count * WORDS_PER_BLOCK; i++) {
+		blocks[i] |= other_blocks[i];
+	}
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty<idx_t>(100, "block_count", block_count);
+	serializer.WriteProperty(101, "blocks", GetData(), SizeInBytes());
+}
+
+shared_ptr<BloomFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto block_count = deserializer.ReadProperty<idx_t>(100, "block_count");
+	auto result = make_shared_ptr<BloomFilter>(block_count);
+	deserializer.ReadProperty(101, "blocks", result->GetData(), result->SizeInBytes());
+	return result;
+}
+
+} // namespace duckdb
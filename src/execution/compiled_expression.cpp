@@ -0,0 +1,604 @@
+#include "duckdb/execution/compiled_expression.hpp"
+
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/operator/add.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/operator/multiply.hpp"
+#include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/planner/expression/list.hpp"
+
+#include <type_traits>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Kernels
+//===--------------------------------------------------------------------===//
+template <class OP>
+struct CheckedArithmetic {
+	template <class T>
+	static inline bool Operation(T left, T right, T &result) {
+		return OP::template Operation<T, T, T>(left, right, result);
+	}
+};
+
+template <class OP>
+struct UncheckedArithmetic {
+	template <class T>
+	static inline bool Operation(T left, T right, T &result) {
+		result = OP::template Operation<T, T, T>(left, right);
+		return true;
+	}
+};
+
+template <class T, class OP>
+static bool ArithmeticKernel(data_ptr_t *registers, const CompiledInstruction &instruction, idx_t count) {
+	auto left = reinterpret_cast<const T *>(registers[instruction.arguments[0]]);
+	auto right = reinterpret_cast<const T *>(registers[instruction.arguments[1]]);
+	auto result = reinterpret_cast<T *>(registers[instruction.result]);
+	bool success = true;
+	for (idx_t i = 0; i < count; i++) {
+		success &= OP::Operation(left[i], right[i], result[i]);
+	}
+	return success;
+}
+
+template <class T>
+static bool NegateKernel(data_ptr_t *registers, const CompiledInstruction &instruction, idx_t count) {
+	auto input = reinterpret_cast<const T *>(registers[instruction.arguments[0]]);
+	auto result = reinterpret_cast<T *>(registers[instruction.result]);
+	bool success = true;
+	for (idx_t i = 0; i < count; i++) {
+		// negating the minimum value of a signed integer overflows
+		success &= !std::is_integral<T>::value || input[i] != NumericLimits<T>::Minimum();
+		result[i] = -input[i];
+	}
+	return success;
+}
+
+template <class T, class OP>
+static bool ComparisonKernel(data_ptr_t *registers, const CompiledInstruction &instruction, idx_t count) {
+	auto left = reinterpret_cast<const T *>(registers[instruction.arguments[0]]);
+	auto right = reinterpret_cast<const T *>(registers[instruction.arguments[1]]);
+	auto result = reinterpret_cast<bool *>(registers[instruction.result]);
+	for (idx_t i = 0; i < count; i++) {
+		result[i] = OP::Operation(left[i], right[i]);
+	}
+	return true;
+}
+
+template <bool IS_AND>
+static bool ConjunctionKernel(data_ptr_t *registers, const CompiledInstruction &instruction, idx_t count) {
+	auto left = reinterpret_cast<const bool *>(registers[instruction.arguments[0]]);
+	auto right = reinterpret_cast<const bool *>(registers[instruction.arguments[1]]);
+	auto result = reinterpret_cast<bool *>(registers[instruction.result]);
+	for (idx_t i = 0; i < count; i++) {
+		result[i] = IS_AND ? left[i] && right[i] : left[i] || right[i];
+	}
+	return true;
+}
+
+static bool NotKernel(data_ptr_t *registers, const CompiledInstruction &instruction, idx_t count) {
+	auto input = reinterpret_cast<const bool *>(registers[instruction.arguments[0]]);
+	auto result = reinterpret_cast<bool *>(registers[instruction.result]);
+	for (idx_t i = 0; i < count; i++) {
+		result[i] = !input[i];
+	}
+	return true;
+}
+
+template <class T>
+static bool CaseKernel(data_ptr_t *registers, const CompiledInstruction &instruction, idx_t count) {
+	auto condition = reinterpret_cast<const bool *>(registers[instruction.arguments[0]]);
+	auto if_true = reinterpret_cast<const T *>(registers[instruction.arguments[1]]);
+	auto if_false = reinterpret_cast<const T *>(registers[instruction.arguments[2]]);
+	auto result = reinterpret_cast<T *>(registers[instruction.result]);
+	for (idx_t i = 0; i < count; i++) {
+		result[i] = condition[i] ? if_true[i] : if_false[i];
+	}
+	return true;
+}
+
+template <class SRC, class DST>
+static bool CastKernel(data_ptr_t *registers, const CompiledInstruction &instruction, idx_t count) {
+	auto input = reinterpret_cast<const SRC *>(registers[instruction.arguments[0]]);
+	auto result = reinterpret_cast<DST *>(registers[instruction.result]);
+	for (idx_t i = 0; i < count; i++) {
+		result[i] = static_cast<DST>(input[i]);
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Kernel Selection
+//===--------------------------------------------------------------------===//
+static bool IsCompiledType(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <class CHECKED_OP, class UNCHECKED_OP>
+static compiled_kernel_t GetArithmeticKernel(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT32:
+		return ArithmeticKernel<int32_t, CheckedArithmetic<CHECKED_OP>>;
+	case PhysicalType::INT64:
+		return ArithmeticKernel<int64_t, CheckedArithmetic<CHECKED_OP>>;
+	case PhysicalType::DOUBLE:
+		return ArithmeticKernel<double, UncheckedArithmetic<UNCHECKED_OP>>;
+	default:
+		return nullptr;
+	}
+}
+
+static compiled_kernel_t GetNegateKernel(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT32:
+		return NegateKernel<int32_t>;
+	case PhysicalType::INT64:
+		return NegateKernel<int64_t>;
+	case PhysicalType::DOUBLE:
+		return NegateKernel<double>;
+	default:
+		return nullptr;
+	}
+}
+
+template <class OP>
+static compiled_kernel_t GetComparisonKernel(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::BOOL:
+		return ComparisonKernel<bool, OP>;
+	case PhysicalType::INT32:
+		return ComparisonKernel<int32_t, OP>;
+	case PhysicalType::INT64:
+		return ComparisonKernel<int64_t, OP>;
+	case PhysicalType::DOUBLE:
+		return ComparisonKernel<double, OP>;
+	default:
+		return nullptr;
+	}
+}
+
+static compiled_kernel_t GetComparisonKernel(ExpressionType type, PhysicalType physical_type) {
+	switch (type) {
+	case ExpressionType::COMPARE_EQUAL:
+		return GetComparisonKernel<Equals>(physical_type);
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return GetComparisonKernel<NotEquals>(physical_type);
+	case ExpressionType::COMPARE_LESSTHAN:
+		return GetComparisonKernel<LessThan>(physical_type);
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return GetComparisonKernel<GreaterThan>(physical_type);
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return GetComparisonKernel<LessThanEquals>(physical_type);
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return GetComparisonKernel<GreaterThanEquals>(physical_type);
+	default:
+		return nullptr;
+	}
+}
+
+static compiled_kernel_t GetCaseKernel(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::BOOL:
+		return CaseKernel<bool>;
+	case PhysicalType::INT32:
+		return CaseKernel<int32_t>;
+	case PhysicalType::INT64:
+		return CaseKernel<int64_t>;
+	case PhysicalType::DOUBLE:
+		return CaseKernel<double>;
+	default:
+		return nullptr;
+	}
+}
+
+static compiled_kernel_t GetCastKernel(PhysicalType source, PhysicalType target) {
+	// only widening casts that cannot fail are compiled
+	if (source == PhysicalType::INT32 && target == PhysicalType::INT64) {
+		return CastKernel<int32_t, int64_t>;
+	}
+	if (source == PhysicalType::INT32 && target == PhysicalType::DOUBLE) {
+		return CastKernel<int32_t, double>;
+	}
+	if (source == PhysicalType::INT64 && target == PhysicalType::DOUBLE) {
+		return CastKernel<int64_t, double>;
+	}
+	return nullptr;
+}
+
+//===--------------------------------------------------------------------===//
+// Compilation
+//===--------------------------------------------------------------------===//
+static bool IsValidRegister(idx_t register_index) {
+	return register_index != DConstants::INVALID_INDEX;
+}
+
+unique_ptr<CompiledExpression> CompiledExpression::Compile(const Expression &expr) {
+	unique_ptr<CompiledExpression> result(new CompiledExpression());
+	auto root = result->CompileNode(expr);
+	if (!IsValidRegister(root) || result->instructions.size() < MINIMUM_INSTRUCTIONS) {
+		return nullptr;
+	}
+	// the root has to be computed by an instruction, so that it can be written to the result directly
+	D_ASSERT(result->register_info[root].type == CompiledRegisterType::INTERMEDIATE);
+	result->root = root;
+	result->AllocateRegisters();
+	return result;
+}
+
+idx_t CompiledExpression::AddRegister(CompiledRegisterType type, PhysicalType physical_type, idx_t column_index) {
+	register_info.push_back(CompiledRegister {type, physical_type, column_index});
+	return register_info.size() - 1;
+}
+
+void CompiledExpression::AddInstruction(compiled_kernel_t kernel, idx_t result, idx_t arg0, idx_t arg1, idx_t arg2) {
+	CompiledInstruction instruction;
+	instruction.kernel = kernel;
+	instruction.result = result;
+	instruction.arguments[0] = arg0;
+	instruction.arguments[1] = arg1;
+	instruction.arguments[2] = arg2;
+	instructions.push_back(instruction);
+}
+
+idx_t CompiledExpression::CompileNode(const Expression &expr) {
+	static constexpr idx_t INVALID = DConstants::INVALID_INDEX;
+	if (!IsCompiledType(expr.return_type)) {
+		return INVALID;
+	}
+	auto physical_type = expr.return_type.InternalType();
+	switch (expr.expression_class) {
+	case ExpressionClass::BOUND_REF: {
+		auto &ref = expr.Cast<BoundReferenceExpression>();
+		// columns that are referenced multiple times share a register
+		for (idx_t i = 0; i < register_info.size(); i++) {
+			if (register_info[i].type == CompiledRegisterType::INPUT_COLUMN && register_info[i].column_index == ref.index) {
+				return register_info[i].physical_type == physical_type ? i : INVALID;
+			}
+		}
+		return AddRegister(CompiledRegisterType::INPUT_COLUMN, physical_type, ref.index);
+	}
+	case ExpressionClass::BOUND_CONSTANT: {
+		auto &constant = expr.Cast<BoundConstantExpression>();
+		if (constant.value.IsNull()) {
+			return INVALID;
+		}
+		constants.push_back(constant.value);
+		return AddRegister(CompiledRegisterType::CONSTANT, physical_type, constants.size() - 1);
+	}
+	case ExpressionClass::BOUND_FUNCTION: {
+		auto &function = expr.Cast<BoundFunctionExpression>();
+		auto &name = function.function.name;
+		for (auto &child : function.children) {
+			if (child->return_type != expr.return_type) {
+				return INVALID;
+			}
+		}
+		compiled_kernel_t kernel = nullptr;
+		if (function.children.size() == 2) {
+			if (name == "+" || name == "add") {
+				kernel = GetArithmeticKernel<TryAddOperator, AddOperator>(physical_type);
+			} else if (name == "-" || name == "subtract") {
+				kernel = GetArithmeticKernel<TrySubtractOperator, SubtractOperator>(physical_type);
+			} else if (name == "*" || name == "multiply") {
+				kernel = GetArithmeticKernel<TryMultiplyOperator, MultiplyOperator>(physical_type);
+			}
+		} else if (function.children.size() == 1 && name == "-") {
+			kernel = GetNegateKernel(physical_type);
+		}
+		if (!kernel) {
+			return INVALID;
+		}
+		idx_t arguments[2] = {0, 0};
+		for (idx_t i = 0; i < function.children.size(); i++) {
+			arguments[i] = CompileNode(*function.children[i]);
+			if (!IsValidRegister(arguments[i])) {
+				return INVALID;
+			}
+		}
+		auto result = AddRegister(CompiledRegisterType::INTERMEDIATE, physical_type);
+		AddInstruction(kernel, result, arguments[0], arguments[1]);
+		return result;
+	}
+	case ExpressionClass::BOUND_COMPARISON: {
+		auto &comparison = expr.Cast<BoundComparisonExpression>();
+		if (comparison.left->return_type != comparison.right->return_type ||
+		    !IsCompiledType(comparison.left->return_type)) {
+			return INVALID;
+		}
+		auto kernel = GetComparisonKernel(comparison.type, comparison.left->return_type.InternalType());
+		if (!kernel) {
+			return INVALID;
+		}
+		auto left = CompileNode(*comparison.left);
+		if (!IsValidRegister(left)) {
+			return INVALID;
+		}
+		auto right = CompileNode(*comparison.right);
+		if (!IsValidRegister(right)) {
+			return INVALID;
+		}
+		auto result = AddRegister(CompiledRegisterType::INTERMEDIATE, physical_type);
+		AddInstruction(kernel, result, left, right);
+		return result;
+	}
+	case ExpressionClass::BOUND_CONJUNCTION: {
+		auto &conjunction = expr.Cast<BoundConjunctionExpression>();
+		compiled_kernel_t kernel;
+		if (conjunction.type == ExpressionType::CONJUNCTION_AND) {
+			kernel = ConjunctionKernel<true>;
+		} else if (conjunction.type == ExpressionType::CONJUNCTION_OR) {
+			kernel = ConjunctionKernel<false>;
+		} else {
+			return INVALID;
+		}
+		// chunks with NULL values are not handled, so the conjunction can use two-valued logic
+		auto result = CompileNode(*conjunction.children[0]);
+		for (idx_t i = 1; i < conjunction.children.size() && IsValidRegister(result); i++) {
+			auto child = CompileNode(*conjunction.children[i]);
+			if (!IsValidRegister(child)) {
+				return INVALID;
+			}
+			auto next = AddRegister(CompiledRegisterType::INTERMEDIATE, physical_type);
+			AddInstruction(kernel, next, result, child);
+			result = next;
+		}
+		return result;
+	}
+	case ExpressionClass::BOUND_OPERATOR: {
+		auto &op = expr.Cast<BoundOperatorExpression>();
+		if (op.type != ExpressionType::OPERATOR_NOT || op.children.size() != 1 ||
+		    op.children[0]->return_type.id() != LogicalTypeId::BOOLEAN) {
+			return INVALID;
+		}
+		auto child = CompileNode(*op.children[0]);
+		if (!IsValidRegister(child)) {
+			return INVALID;
+		}
+		auto result = AddRegister(CompiledRegisterType::INTERMEDIATE, physical_type);
+		AddInstruction(NotKernel, result, child);
+		return result;
+	}
+	case ExpressionClass::BOUND_CASE: {
+		auto &case_expr = expr.Cast<BoundCaseExpression>();
+		auto kernel = GetCaseKernel(physical_type);
+		if (!kernel || case_expr.else_expr->return_type != expr.return_type) {
+			return INVALID;
+		}
+		// all branches are evaluated for all rows, and the results are combined from the last check to the first
+		// errors in the branches (i.e. overflows) make the chunk fall back to the interpreter, which only evaluates
+		// the branches for the rows that take them
+		vector<idx_t> conditions;
+		vector<idx_t> values;
+		for (auto &check : case_expr.case_checks) {
+			if (check.then_expr->return_type != expr.return_type) {
+				return INVALID;
+			}
+			auto condition = CompileNode(*check.when_expr);
+			if (!IsValidRegister(condition)) {
+				return INVALID;
+			}
+			auto value = CompileNode(*check.then_expr);
+			if (!IsValidRegister(value)) {
+				return INVALID;
+			}
+			conditions.push_back(condition);
+			values.push_back(value);
+		}
+		auto result = CompileNode(*case_expr.else_expr);
+		for (idx_t i = conditions.size(); i > 0 && IsValidRegister(result); i--) {
+			auto next = AddRegister(CompiledRegisterType::INTERMEDIATE, physical_type);
+			AddInstruction(kernel, next, conditions[i - 1], values[i - 1], result);
+			result = next;
+		}
+		return result;
+	}
+	case ExpressionClass::BOUND_CAST: {
+		auto &cast = expr.Cast<BoundCastExpression>();
+		if (!IsCompiledType(cast.child->return_type)) {
+			return INVALID;
+		}
+		auto kernel = GetCastKernel(cast.child->return_type.InternalType(), physical_type);
+		if (!kernel) {
+			return INVALID;
+		}
+		auto child = CompileNode(*cast.child);
+		if (!IsValidRegister(child)) {
+			return INVALID;
+		}
+		auto result = AddRegister(CompiledRegisterType::INTERMEDIATE, physical_type);
+		AddInstruction(kernel, result, child);
+		return result;
+	}
+	default:
+		return INVALID;
+	}
+}
+
+template <class T>
+static void BroadcastConstant(data_ptr_t buffer, T value) {
+	auto data = reinterpret_cast<T *>(buffer);
+	for (idx_t i = 0; i < CompiledExpression::TILE_SIZE; i++) {
+		data[i] = value;
+	}
+}
+
+void CompiledExpression::AllocateRegisters() {
+	// every register gets a buffer that fits a tile of the widest type
+	static constexpr idx_t REGISTER_SIZE = TILE_SIZE * sizeof(int64_t);
+	register_memory = make_unsafe_uniq_array<data_t>(register_info.size() * REGISTER_SIZE);
+	register_buffers.resize(register_info.size());
+	registers.resize(register_info.size());
+	for (idx_t i = 0; i < register_info.size(); i++) {
+		register_buffers[i] = register_memory.get() + i * REGISTER_SIZE;
+		registers[i] = register_buffers[i];
+		auto &info = register_info[i];
+		if (info.type != CompiledRegisterType::CONSTANT) {
+			continue;
+		}
+		auto &value = constants[info.column_index];
+		switch (info.physical_type) {
+		case PhysicalType::BOOL:
+			BroadcastConstant<bool>(register_buffers[i], value.GetValueUnsafe<bool>());
+			break;
+		case PhysicalType::INT32:
+			BroadcastConstant<int32_t>(register_buffers[i], value.GetValueUnsafe<int32_t>());
+			break;
+		case PhysicalType::INT64:
+			BroadcastConstant<int64_t>(register_buffers[i], value.GetValueUnsafe<int64_t>());
+			break;
+		case PhysicalType::DOUBLE:
+			BroadcastConstant<double>(register_buffers[i], value.GetValueUnsafe<double>());
+			break;
+		default:
+			throw InternalException("Unsupported type for CompiledExpression constant");
+		}
+	}
+	input_formats.resize(register_info.size());
+	input_is_flat.resize(register_info.size());
+}
+
+//===--------------------------------------------------------------------===//
+// Execution
+//===--------------------------------------------------------------------===//
+bool CompiledExpression::PrepareInput(DataChunk &input) {
+	auto count = input.size();
+	for (idx_t i = 0; i < register_info.size(); i++) {
+		auto &info = register_info[i];
+		if (info.type != CompiledRegisterType::INPUT_COLUMN) {
+			continue;
+		}
+		auto &vector = input.data[info.column_index];
+		if (vector.GetType().InternalType() != info.physical_type) {
+			return false;
+		}
+		auto &format = input_formats[i];
+		vector.ToUnifiedFormat(count, format);
+		if (!format.validity.AllValid()) {
+			for (idx_t row = 0; row < count; row++) {
+				if (!format.validity.RowIsValid(format.sel->get_index(row))) {
+					// NULL values are left to the interpreter
+					return false;
+				}
+			}
+		}
+		input_is_flat[i] = vector.GetVectorType() == VectorType::FLAT_VECTOR;
+	}
+	return true;
+}
+
+template <class T>
+static void GatherTile(UnifiedVectorFormat &format, data_ptr_t buffer, idx_t start, idx_t count) {
+	auto source = UnifiedVectorFormat::GetData<T>(format);
+	auto target = reinterpret_cast<T *>(buffer);
+	for (idx_t i = 0; i < count; i++) {
+		target[i] = source[format.sel->get_index(start + i)];
+	}
+}
+
+void CompiledExpression::LoadTile(idx_t start, idx_t count) {
+	for (idx_t i = 0; i < register_info.size(); i++) {
+		auto &info = register_info[i];
+		if (info.type != CompiledRegisterType::INPUT_COLUMN) {
+			continue;
+		}
+		auto &format = input_formats[i];
+		if (input_is_flat[i]) {
+			// flat vectors are read directly
+			registers[i] = format.data + start * GetTypeIdSize(info.physical_type);
+			continue;
+		}
+		switch (info.physical_type) {
+		case PhysicalType::BOOL:
+			GatherTile<bool>(format, register_buffers[i], start, count);
+			break;
+		case PhysicalType::INT32:
+			GatherTile<int32_t>(format, register_buffers[i], start, count);
+			break;
+		case PhysicalType::INT64:
+			GatherTile<int64_t>(format, register_buffers[i], start, count);
+			break;
+		case PhysicalType::DOUBLE:
+			GatherTile<double>(format, register_buffers[i], start, count);
+			break;
+		default:
+			throw InternalException("Unsupported type for CompiledExpression input");
+		}
+		registers[i] = register_buffers[i];
+	}
+}
+
+bool CompiledExpression::ExecuteTile(idx_t count) {
+	for (auto &instruction : instructions) {
+		if (!instruction.kernel(registers.data(), instruction, count)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool CompiledExpression::Execute(DataChunk &input, Vector &result) {
+	if (result.GetVectorType() != VectorType::FLAT_VECTOR || !PrepareInput(input)) {
+		return false;
+	}
+	auto count = input.size();
+	auto result_data = FlatVector::GetData(result);
+	auto result_width = GetTypeIdSize(register_info[root].physical_type);
+	for (idx_t start = 0; start < count; start += TILE_SIZE) {
+		auto tile_count = MinValue<idx_t>(TILE_SIZE, count - start);
+		LoadTile(start, tile_count);
+		// the last instruction writes directly into the result vector
+		registers[root] = result_data + start * result_width;
+		if (!ExecuteTile(tile_count)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool CompiledExpression::Select(DataChunk &input, SelectionVector *true_sel, SelectionVector *false_sel,
+                                idx_t &true_count) {
+	D_ASSERT(register_info[root].physical_type == PhysicalType::BOOL);
+	if (!PrepareInput(input)) {
+		return false;
+	}
+	auto count = input.size();
+	idx_t result_true_count = 0;
+	idx_t result_false_count = 0;
+	registers[root] = register_buffers[root];
+	auto matches = reinterpret_cast<const bool *>(register_buffers[root]);
+	for (idx_t start = 0; start < count; start += TILE_SIZE) {
+		auto tile_count = MinValue<idx_t>(TILE_SIZE, count - start);
+		LoadTile(start, tile_count);
+		if (!ExecuteTile(tile_count)) {
+			return false;
+		}
+		for (idx_t i = 0; i < tile_count; i++) {
+			auto row = start + i;
+			if (matches[i]) {
+				if (true_sel) {
+					true_sel->set_index(result_true_count, row);
+				}
+				result_true_count++;
+			} else {
+				if (false_sel) {
+					false_sel->set_index(result_false_count, row);
+				}
+				result_false_count++;
+			}
+		}
+	}
+	true_count = result_true_count;
+	return true;
+}
+
+} // namespace duckdb
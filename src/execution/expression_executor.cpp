@@ -1,7 +1,9 @@
 #include "duckdb/execution/expression_executor.hpp"
 
 #include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/compiled_expression.hpp"
 #include "duckdb/execution/execution_context.hpp"
+#include "duckdb/main/client_config.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/planner/expression/list.hpp"
 
@@ -59,6 +61,9 @@ void ExpressionExecutor::AddExpression(const Expression &expr) {
 	auto state = make_uniq<ExpressionExecutorState>();
 	Initialize(expr, *state);
 	state->Verify();
+	if (context && ClientConfig::GetConfig(*context).enable_compiled_expressions) {
+		state->compiled_expression = CompiledExpression::Compile(expr);
+	}
 	states.push_back(std::move(state));
 }
 
@@ -87,7 +92,12 @@ void ExpressionExecutor::ExecuteExpression(DataChunk &input, Vector &result) {
 idx_t ExpressionExecutor::SelectExpression(DataChunk &input, SelectionVector &sel) {
 	D_ASSERT(expressions.size() == 1);
 	SetChunk(&input);
-	idx_t selected_tuples = Select(*expressions[0], states[0]->root_state.get(), nullptr, input.size(), &sel, nullptr);
+	auto &compiled_expression = states[0]->compiled_expression;
+	idx_t selected_tuples;
+	if (compiled_expression && compiled_expression->Select(input, &sel, nullptr, selected_tuples)) {
+		return selected_tuples;
+	}
+	selected_tuples = Select(*expressions[0], states[0]->root_state.get(), nullptr, input.size(), &sel, nullptr);
 	return selected_tuples;
 }
 
@@ -99,6 +109,11 @@ void ExpressionExecutor::ExecuteExpression(Vector &result) {
 void ExpressionExecutor::ExecuteExpression(idx_t expr_idx, Vector &result) {
 	D_ASSERT(expr_idx < expressions.size());
 	D_ASSERT(result.GetType().id() == expressions[expr_idx]->return_type.id());
+	auto &compiled_expression = states[expr_idx]->compiled_expression;
+	if (compiled_expression && chunk && chunk->size() > 0 && compiled_expression->Execute(*chunk, result)) {
+		Verify(*expressions[expr_idx], result, chunk->size());
+		return;
+	}
 	Execute(*expressions[expr_idx], states[expr_idx]->root_state.get(), nullptr, chunk ? chunk->size() : 1, result);
 }
 
@@ -1,5 +1,6 @@
 #include "duckdb/execution/expression_executor_state.hpp"
 
+#include "duckdb/execution/compiled_expression.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
@@ -43,6 +44,9 @@ ExpressionState::ExpressionState(const Expression &expr, ExpressionExecutorState
 ExpressionExecutorState::ExpressionExecutorState() {
 }
 
+ExpressionExecutorState::~ExpressionExecutorState() {
+}
+
 void ExpressionState::Verify(ExpressionExecutorState &root_executor) {
 	D_ASSERT(&root_executor == &root);
 	for (auto &entry : child_states) {
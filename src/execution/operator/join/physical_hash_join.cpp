@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/types/value_map.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
@@ -14,7 +15,9 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_table_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -95,6 +98,9 @@ PhysicalHashJoin::PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOpera
 JoinFilterGlobalState::~JoinFilterGlobalState() {
 }
 
+JoinFilterLocalState::JoinFilterLocalState() : hashes(LogicalType::HASH) {
+}
+
 JoinFilterLocalState::~JoinFilterLocalState() {
 }
 
@@ -106,6 +112,14 @@ unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(ClientC
 	auto result = make_uniq<JoinFilterGlobalState>();
 	result->global_aggregate_state =
 	    make_uniq<GlobalUngroupedAggregateState>(BufferAllocator::Get(context), min_max_aggregates);
+	if (build_bloom_filters) {
+		// size the Bloom filters based on the estimated cardinality of the build side
+		auto block_count = BloomFilter::GetBlockCount(op.children[1]->estimated_cardinality, BLOOM_FILTER_BITS_PER_KEY,
+		                                              BLOOM_FILTER_MAX_BLOCKS);
+		for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+			result->bloom_filters.push_back(make_shared_ptr<BloomFilter>(block_count));
+		}
+	}
 	return result;
 }
 
@@ -175,6 +189,9 @@ public:
 
 unique_ptr<JoinFilterLocalState> JoinFilterPushdownInfo::GetLocalState(JoinFilterGlobalState &gstate) const {
 	auto result = make_uniq<JoinFilterLocalState>();
+	for (auto &global_filter : gstate.bloom_filters) {
+		result->bloom_filters.push_back(make_uniq<BloomFilter>(global_filter->BlockCount()));
+	}
 	result->local_aggregate_state = make_uniq<LocalUngroupedAggregateState>(*gstate.global_aggregate_state);
 	return result;
 }
@@ -287,6 +304,22 @@ void JoinFilterPushdownInfo::Sink(DataChunk &chunk, JoinFilterLocalState &lstate
 			lstate.local_aggregate_state->Sink(chunk, pushdown.join_condition, aggr_idx);
 		}
 	}
+	// insert the hashes of the (non-NULL) keys into the Bloom filters
+	for (idx_t filter_idx = 0; filter_idx < lstate.bloom_filters.size(); filter_idx++) {
+		auto &keys = chunk.data[filters[filter_idx].join_condition];
+		UnifiedVectorFormat key_data;
+		keys.ToUnifiedFormat(chunk.size(), key_data);
+
+		SelectionVector valid_sel(chunk.size());
+		idx_t valid_count = 0;
+		for (idx_t i = 0; i < chunk.size(); i++) {
+			valid_sel.set_index(valid_count, i);
+			valid_count += key_data.validity.RowIsValid(key_data.sel->get_index(i));
+		}
+		VectorOperations::Hash(keys, lstate.hashes, valid_sel, valid_count);
+		lstate.hashes.Flatten(chunk.size());
+		lstate.bloom_filters[filter_idx]->Insert(lstate.hashes, valid_sel, valid_count);
+	}
 }
 
 SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
@@ -321,6 +354,12 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 
 void JoinFilterPushdownInfo::Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const {
 	gstate.global_aggregate_state->Combine(*lstate.local_aggregate_state);
+	if (!lstate.bloom_filters.empty()) {
+		lock_guard<mutex> guard(gstate.lock);
+		for (idx_t filter_idx = 0; filter_idx < lstate.bloom_filters.size(); filter_idx++) {
+			gstate.bloom_filters[filter_idx]->Merge(*lstate.bloom_filters[filter_idx]);
+		}
+	}
 }
 
 SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
@@ -563,7 +602,39 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+bool JoinFilterPushdownInfo::PushInFilter(JoinHashTable &ht, const PhysicalOperator &op, idx_t filter_idx) const {
+	auto &filter = filters[filter_idx];
+	if (ht.Count() > IN_FILTER_THRESHOLD) {
+		// the build side is too large for an IN filter
+		return false;
+	}
+	// the build side is small - collect the distinct keys from the hash table
+	auto &data_collection = ht.GetDataCollection();
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, vector<column_t> {filter.join_condition});
+	DataChunk scan_chunk;
+	data_collection.InitializeScanChunk(scan_state, scan_chunk);
+
+	value_set_t unique_values;
+	while (data_collection.Scan(scan_state, scan_chunk)) {
+		for (idx_t row_idx = 0; row_idx < scan_chunk.size(); row_idx++) {
+			auto value = scan_chunk.data[0].GetValue(row_idx);
+			if (!value.IsNull()) {
+				unique_values.insert(std::move(value));
+			}
+		}
+	}
+	if (unique_values.empty()) {
+		return false;
+	}
+	vector<Value> in_values(unique_values.begin(), unique_values.end());
+	auto in_filter = make_uniq<InFilter>(std::move(in_values));
+	dynamic_filters->PushFilter(op, filter.probe_column_index.column_index, std::move(in_filter));
+	return true;
+}
+
+void JoinFilterPushdownInfo::PushFilters(JoinHashTable &ht, JoinFilterGlobalState &gstate,
+                                         const PhysicalOperator &op) const {
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -589,7 +660,8 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 			// table e.g. because they are part of a RIGHT join
 			continue;
 		}
-		if (Value::NotDistinctFrom(min_val, max_val)) {
+		auto is_equality = Value::NotDistinctFrom(min_val, max_val);
+		if (is_equality) {
 			// min = max - generate an equality filter
 			auto constant_filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val));
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(constant_filter));
@@ -603,13 +675,52 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 		}
 		// not null filter
 		dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<IsNotNullFilter>());
+		if (is_equality) {
+			// the equality filter is already exact
+			continue;
+		}
+		if (PushInFilter(ht, op, filter_idx)) {
+			// the build side was small enough to push the exact set of keys
+			continue;
+		}
+		if (gstate.bloom_filters.empty()) {
+			continue;
+		}
+		// push the Bloom filter - unless the build side was so much larger than expected that it is no longer selective
+		auto &bloom_filter = gstate.bloom_filters[filter_idx];
+		if (bloom_filter->EstimatedFalsePositiveRate(ht.Count()) <= BLOOM_FILTER_MAX_FALSE_POSITIVE_RATE) {
+			dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<BloomTableFilter>(bloom_filter));
+		}
+	}
+}
+
+static void ReportBuildMisestimate(ClientContext &context, const PhysicalHashJoin &op, HashJoinGlobalSinkState &sink) {
+	auto &profiler = QueryProfiler::Get(context);
+	if (!profiler.IsEnabled()) {
+		return;
+	}
+	// the rows are still in the sink collections of the thread-local hash tables
+	idx_t build_count = 0;
+	for (auto &local_ht : sink.local_hash_tables) {
+		build_count += local_ht->GetSinkCollection().Count();
+	}
+	// the join order was chosen based on the estimate - report it if the true cardinality is far off
+	auto estimated_count = op.children[1]->estimated_cardinality;
+	auto lower = MaxValue<idx_t>(MinValue<idx_t>(build_count, estimated_count), 1);
+	auto upper = MaxValue<idx_t>(build_count, estimated_count);
+	if (upper / lower < PhysicalHashJoin::BUILD_MISESTIMATE_THRESHOLD) {
+		return;
 	}
+	profiler.AddOperatorInfo(op, "Build Misestimate",
+	                         StringUtil::Format("%llux (~%llu rows estimated, %llu rows built)", upper / lower,
+	                                            estimated_count, build_count));
 }
 
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                             OperatorSinkFinalizeInput &input) const {
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
+	ReportBuildMisestimate(context, *this, sink);
 
 	sink.temporary_memory_state->UpdateReservation(context);
 	sink.external = sink.temporary_memory_state->GetReservation() < sink.total_size;
@@ -649,7 +760,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		filter_pushdown->PushFilters(ht, *sink.global_filter_state, *this);
 	}
 
 	// check for possible perfect hash table
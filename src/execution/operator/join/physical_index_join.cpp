@@ -0,0 +1,216 @@
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/enum_util.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+PhysicalIndexJoin::PhysicalIndexJoin(vector<LogicalType> types, unique_ptr<PhysicalOperator> probe,
+                                     DuckTableEntry &table, string index_name_p, string index_column_name_p,
+                                     unique_ptr<Expression> probe_key_p, vector<idx_t> probe_projection_map_p,
+                                     vector<column_t> fetch_ids_p, vector<LogicalType> fetch_types_p, bool fetch_first,
+                                     idx_t estimated_cardinality)
+    : CachingPhysicalOperator(PhysicalOperatorType::INDEX_JOIN, std::move(types), estimated_cardinality), table(table),
+      index_name(std::move(index_name_p)), index_column_name(std::move(index_column_name_p)),
+      probe_key(std::move(probe_key_p)), probe_projection_map(std::move(probe_projection_map_p)),
+      fetch_ids(std::move(fetch_ids_p)), fetch_types(std::move(fetch_types_p)), fetch_first(fetch_first) {
+	D_ASSERT(fetch_ids.size() == fetch_types.size());
+	children.push_back(std::move(probe));
+}
+
+//===--------------------------------------------------------------------===//
+// Operator
+//===--------------------------------------------------------------------===//
+//! The row ids that match the probe rows of the current input chunk, either in the table or in the transaction-local
+//! storage of the table
+struct IndexJoinMatches {
+	//! The probe row of every match
+	vector<sel_t> probe_rows;
+	//! The row id of every match
+	vector<row_t> row_ids;
+	//! The matches before this offset have been emitted
+	idx_t offset = 0;
+
+	bool Exhausted() const {
+		return offset >= row_ids.size();
+	}
+	void Reset() {
+		probe_rows.clear();
+		row_ids.clear();
+		offset = 0;
+	}
+};
+
+class IndexJoinOperatorState : public CachingOperatorState {
+public:
+	IndexJoinOperatorState(ExecutionContext &context, const PhysicalIndexJoin &op)
+	    : probe_executor(context.client, *op.probe_key), arena_allocator(BufferAllocator::Get(context.client)),
+	      keys(STANDARD_VECTOR_SIZE), result_sel(STANDARD_VECTOR_SIZE) {
+		join_keys.Initialize(context.client, {op.probe_key->return_type});
+
+		// we always fetch the row id as well, so that we know which of the rows passed the visibility check
+		fetch_column_ids = op.fetch_ids;
+		fetch_column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+		auto types = op.fetch_types;
+		types.emplace_back(LogicalType::ROW_TYPE);
+		fetch_chunk.Initialize(context.client, types);
+
+		auto &storage = op.table.GetStorage();
+		storage.GetDataTableInfo()->GetIndexes().ScanBound<ART>([&](ART &art) {
+			if (art.GetIndexName() == op.index_name) {
+				index = &art;
+				return true;
+			}
+			return false;
+		});
+		if (!index) {
+			throw InternalException("PhysicalIndexJoin - index \"%s\" not found", op.index_name);
+		}
+		// rows appended by this transaction are only present in the index of the transaction-local storage
+		auto &local_storage = LocalStorage::Get(context.client, op.table.catalog);
+		if (local_storage.Find(storage)) {
+			local_storage.GetIndexes(storage).ScanBound<ART>([&](ART &art) {
+				if (art.GetIndexName() == op.index_name) {
+					local_index = &art;
+					return true;
+				}
+				return false;
+			});
+		}
+	}
+
+	ExpressionExecutor probe_executor;
+	DataChunk join_keys;
+	ArenaAllocator arena_allocator;
+	vector<ARTKey> keys;
+
+	optional_ptr<ART> index;
+	optional_ptr<ART> local_index;
+
+	bool initialized = false;
+	IndexJoinMatches matches;
+	IndexJoinMatches local_matches;
+
+	vector<column_t> fetch_column_ids;
+	DataChunk fetch_chunk;
+	ColumnFetchState fetch_state;
+	SelectionVector result_sel;
+
+public:
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op, probe_executor, "probe_executor", 0);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalIndexJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<IndexJoinOperatorState>(context, *this);
+}
+
+static void LookupMatches(ART &art, vector<ARTKey> &keys, idx_t count, IndexJoinMatches &matches) {
+	IndexLock lock;
+	art.InitializeLock(lock);
+	for (idx_t i = 0; i < count; i++) {
+		if (keys[i].Empty()) {
+			// NULL never matches
+			continue;
+		}
+		auto match_start = matches.row_ids.size();
+		art.SearchEqual(keys[i], NumericLimits<idx_t>::Maximum(), matches.row_ids);
+		for (idx_t match_idx = match_start; match_idx < matches.row_ids.size(); match_idx++) {
+			matches.probe_rows.push_back(UnsafeNumericCast<sel_t>(i));
+		}
+	}
+}
+
+OperatorResultType PhysicalIndexJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                      GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<IndexJoinOperatorState>();
+	auto &transaction = DuckTransaction::Get(context.client, table.catalog);
+	auto &storage = table.GetStorage();
+
+	if (!state.initialized) {
+		// look up the keys of the input chunk in the index(es)
+		state.join_keys.Reset();
+		state.probe_executor.Execute(input, state.join_keys);
+		state.arena_allocator.Reset();
+		ART::GenerateKeys<>(state.arena_allocator, state.join_keys, state.keys);
+
+		LookupMatches(*state.index, state.keys, input.size(), state.matches);
+		if (state.local_index) {
+			LookupMatches(*state.local_index, state.keys, input.size(), state.local_matches);
+		}
+		state.initialized = true;
+	}
+
+	// fetch the next batch of matches, the index can contain row ids that are not visible to this transaction
+	// (e.g. deleted rows), so we might have to fetch multiple batches until we have a match
+	idx_t result_count = 0;
+	while (result_count == 0 && !(state.matches.Exhausted() && state.local_matches.Exhausted())) {
+		auto is_local = state.matches.Exhausted();
+		auto &matches = is_local ? state.local_matches : state.matches;
+		auto fetch_count = MinValue<idx_t>(matches.row_ids.size() - matches.offset, STANDARD_VECTOR_SIZE);
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(matches.row_ids.data() + matches.offset));
+
+		state.fetch_chunk.Reset();
+		if (is_local) {
+			auto &local_storage = LocalStorage::Get(transaction);
+			local_storage.FetchChunk(storage, row_ids, fetch_count, state.fetch_column_ids, state.fetch_chunk,
+			                         state.fetch_state);
+		} else {
+			storage.Fetch(transaction, state.fetch_chunk, state.fetch_column_ids, row_ids, fetch_count,
+			              state.fetch_state);
+		}
+
+		// the fetched rows are a subsequence of the requested rows: match them up with their probe rows
+		auto fetched_row_ids = FlatVector::GetData<row_t>(state.fetch_chunk.data.back());
+		for (idx_t i = 0; i < fetch_count && result_count < state.fetch_chunk.size(); i++) {
+			if (matches.row_ids[matches.offset + i] == fetched_row_ids[result_count]) {
+				state.result_sel.set_index(result_count++, matches.probe_rows[matches.offset + i]);
+			}
+		}
+		D_ASSERT(result_count == state.fetch_chunk.size());
+		matches.offset += fetch_count;
+	}
+
+	if (result_count > 0) {
+		auto probe_offset = fetch_first ? fetch_ids.size() : 0;
+		auto fetch_offset = fetch_first ? 0 : probe_projection_map.size();
+		for (idx_t i = 0; i < fetch_ids.size(); i++) {
+			chunk.data[fetch_offset + i].Reference(state.fetch_chunk.data[i]);
+		}
+		for (idx_t i = 0; i < probe_projection_map.size(); i++) {
+			chunk.data[probe_offset + i].Slice(input.data[probe_projection_map[i]], state.result_sel, result_count);
+		}
+	}
+	chunk.SetCardinality(result_count);
+
+	if (state.matches.Exhausted() && state.local_matches.Exhausted()) {
+		// all matches of this input chunk have been emitted
+		state.matches.Reset();
+		state.local_matches.Reset();
+		state.initialized = false;
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+	return OperatorResultType::HAVE_MORE_OUTPUT;
+}
+
+InsertionOrderPreservingMap<string> PhysicalIndexJoin::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	result["Join Type"] = EnumUtil::ToString(JoinType::INNER);
+	result["Table"] = table.name;
+	result["Index"] = index_name;
+	result["Conditions"] = StringUtil::Format("%s = %s", probe_key->GetName(), index_column_name);
+	result["Estimated Cardinality"] = StringUtil::Format("%llu", estimated_cardinality);
+	return result;
+}
+
+} // namespace duckdb
@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/persistent/physical_batch_insert.hpp"
 #include "duckdb/execution/operator/persistent/batch_memory_manager.hpp"
 #include "duckdb/execution/operator/persistent/batch_task_manager.hpp"
+#include "duckdb/main/materialized_view_maintenance.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/table/row_group_collection.hpp"
@@ -141,6 +142,8 @@ public:
 	idx_t next_start = 0;
 	atomic<bool> optimistically_written;
 	idx_t minimum_memory_per_thread;
+	//! Whether or not the inserted rows have to be propagated to materialized views
+	bool track_views = false;
 
 	static bool ReadyToMerge(idx_t count);
 	void ScheduleMergeTasks(idx_t min_batch_index);
@@ -392,6 +395,7 @@ unique_ptr<GlobalSinkState> PhysicalBatchInsert::GetGlobalSinkState(ClientContex
 	static constexpr const idx_t MINIMUM_MEMORY_PER_COLUMN = 4ULL * 1024ULL * 1024ULL;
 	auto minimum_memory_per_thread = table->GetColumns().PhysicalColumnCount() * MINIMUM_MEMORY_PER_COLUMN;
 	auto result = make_uniq<BatchInsertGlobalState>(context, table->Cast<DuckTableEntry>(), minimum_memory_per_thread);
+	result->track_views = !info && MaterializedViewMaintenance::HasMaterializedViews(context, *table);
 	return std::move(result);
 }
 
@@ -501,6 +505,9 @@ SinkResultType PhysicalBatchInsert::Sink(ExecutionContext &context, DataChunk &c
 		lstate.constraint_state = table.GetStorage().InitializeConstraintState(table, bound_constraints);
 	}
 	table.GetStorage().VerifyAppendConstraints(*lstate.constraint_state, context.client, lstate.insert_chunk);
+	if (gstate.track_views) {
+		MaterializedViewMaintenance::Get(context.client).AddInsertedRows(context.client, table, lstate.insert_chunk);
+	}
 
 	auto new_row_group = lstate.current_collection->Append(lstate.insert_chunk, lstate.current_append_state);
 	if (new_row_group) {
@@ -591,10 +598,17 @@ SinkFinalizeType PhysicalBatchInsert::Finalize(Pipeline &pipeline, Event &event,
 		}
 
 		// finally, merge the row groups into the local storage
+		// the index entries of the merged row groups are constructed in parallel afterwards
+		vector<unique_ptr<LocalIndexAppend>> index_appends;
 		for (auto &collection : final_collections) {
-			storage.LocalMerge(context, *collection);
+			auto index_append = storage.InitializeLocalIndexAppend(context, *collection);
+			storage.LocalMerge(context, *collection, index_append.get());
+			if (index_append) {
+				index_appends.push_back(std::move(index_append));
+			}
 		}
 		storage.FinalizeOptimisticWriter(context, writer);
+		storage.FinalizeLocalIndexAppends(context, index_appends);
 	} else {
 		// we are writing a small amount of data to disk
 		// append directly to transaction local storage
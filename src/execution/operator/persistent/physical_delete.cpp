@@ -3,6 +3,7 @@
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/main/materialized_view_maintenance.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
@@ -30,6 +31,8 @@ public:
 	mutex delete_lock;
 	idx_t deleted_count;
 	ColumnDataCollection return_collection;
+	//! Whether or not the deleted rows have to be propagated to materialized views
+	bool track_views = false;
 };
 
 class DeleteLocalState : public LocalSinkState {
@@ -64,12 +67,18 @@ SinkResultType PhysicalDelete::Sink(ExecutionContext &context, DataChunk &chunk,
 		table.Fetch(transaction, ustate.delete_chunk, column_ids, row_identifiers, chunk.size(), cfs);
 		gstate.return_collection.Append(ustate.delete_chunk);
 	}
+	if (gstate.track_views) {
+		MaterializedViewMaintenance::Get(context.client)
+		    .AddDeletedRows(context.client, tableref, row_identifiers, chunk.size());
+	}
 	gstate.deleted_count += table.Delete(*ustate.delete_state, context.client, row_identifiers, chunk.size());
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
 unique_ptr<GlobalSinkState> PhysicalDelete::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<DeleteGlobalState>(context, GetTypes());
+	auto result = make_uniq<DeleteGlobalState>(context, GetTypes());
+	result->track_views = MaterializedViewMaintenance::HasMaterializedViews(context, tableref);
+	return std::move(result);
 }
 
 unique_ptr<LocalSinkState> PhysicalDelete::GetLocalSinkState(ExecutionContext &context) const {
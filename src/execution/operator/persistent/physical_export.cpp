@@ -253,6 +253,9 @@ SourceResultType PhysicalExport::GetData(ExecutionContext &context, DataChunk &c
 	// for every table, we write COPY INTO statement with the specified options
 	stringstream load_ss;
 	for (idx_t i = 0; i < exported_tables.data.size(); i++) {
+		if (exported_tables.data[i].entry.IsMaterializedView()) {
+			continue;
+		}
 		auto exported_table_info = exported_tables.data[i].table_data;
 		WriteCopyStatement(fs, load_ss, *info, exported_table_info, function);
 	}
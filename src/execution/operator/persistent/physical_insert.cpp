@@ -6,6 +6,7 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/materialized_view_maintenance.hpp"
 #include "duckdb/parser/parsed_data/create_table_info.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
@@ -84,6 +85,8 @@ public:
 	bool initialized;
 	LocalAppendState append_state;
 	ColumnDataCollection return_collection;
+	//! Whether or not the inserted rows have to be propagated to materialized views
+	bool track_views = false;
 };
 
 class InsertLocalState : public LocalSinkState {
@@ -130,6 +133,7 @@ unique_ptr<GlobalSinkState> PhysicalInsert::GetGlobalSinkState(ClientContext &co
 		table = insert_table.get_mutable();
 	}
 	auto result = make_uniq<InsertGlobalState>(context, GetTypes(), table->Cast<DuckTableEntry>());
+	result->track_views = !info && MaterializedViewMaintenance::HasMaterializedViews(context, *table);
 	return std::move(result);
 }
 
@@ -432,6 +436,17 @@ idx_t PhysicalInsert::OnConflictHandling(TableCatalogEntry &table, ExecutionCont
 	return updated_tuples;
 }
 
+static void TrackViewChanges(ExecutionContext &context, TableCatalogEntry &table, DataChunk &insert_chunk,
+                             idx_t updated_tuples) {
+	auto &maintenance = MaterializedViewMaintenance::Get(context.client);
+	if (updated_tuples > 0) {
+		// rows updated by ON CONFLICT are not captured - the views have to be recomputed
+		maintenance.RequireRefresh(context.client, table);
+		return;
+	}
+	maintenance.AddInsertedRows(context.client, table, insert_chunk);
+}
+
 SinkResultType PhysicalInsert::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &gstate = input.global_state.Cast<InsertGlobalState>();
 	auto &lstate = input.local_state.Cast<InsertLocalState>();
@@ -458,6 +473,9 @@ SinkResultType PhysicalInsert::Sink(ExecutionContext &context, DataChunk &chunk,
 			// we add the tuples that did not get filtered out now
 			gstate.return_collection.Append(lstate.insert_chunk);
 		}
+		if (gstate.track_views) {
+			TrackViewChanges(context, table, lstate.insert_chunk, updated_tuples);
+		}
 		gstate.insert_count += lstate.insert_chunk.size();
 		gstate.insert_count += updated_tuples;
 		storage.LocalAppend(gstate.append_state, table, context.client, lstate.insert_chunk, true);
@@ -481,7 +499,10 @@ SinkResultType PhysicalInsert::Sink(ExecutionContext &context, DataChunk &chunk,
 			lstate.local_collection->InitializeAppend(lstate.local_append_state);
 			lstate.writer = &gstate.table.GetStorage().CreateOptimisticWriter(context.client);
 		}
-		OnConflictHandling(table, context, lstate);
+		auto updated_tuples = OnConflictHandling(table, context, lstate);
+		if (gstate.track_views) {
+			TrackViewChanges(context, table, lstate.insert_chunk, updated_tuples);
+		}
 
 		auto new_row_group = lstate.local_collection->Append(lstate.insert_chunk, lstate.local_append_state);
 		if (new_row_group) {
@@ -508,13 +529,13 @@ SinkCombineResultType PhysicalInsert::Combine(ExecutionContext &context, Operato
 	lstate.local_collection->FinalizeAppend(tdata, lstate.local_append_state);
 
 	auto append_count = lstate.local_collection->GetTotalRows();
+	auto &storage = gstate.table.GetStorage();
 
-	lock_guard<mutex> lock(gstate.lock);
-	gstate.insert_count += append_count;
 	if (append_count < Storage::ROW_GROUP_SIZE) {
 		// we have few rows - append to the local storage directly
+		lock_guard<mutex> lock(gstate.lock);
+		gstate.insert_count += append_count;
 		auto &table = gstate.table;
-		auto &storage = table.GetStorage();
 		storage.InitializeLocalAppend(gstate.append_state, table, context.client, bound_constraints);
 		auto &transaction = DuckTransaction::Get(context.client, table.catalog);
 		lstate.local_collection->Scan(transaction, [&](DataChunk &insert_chunk) {
@@ -522,12 +543,24 @@ SinkCombineResultType PhysicalInsert::Combine(ExecutionContext &context, Operato
 			return true;
 		});
 		storage.FinalizeLocalAppend(gstate.append_state);
-	} else {
-		// we have written rows to disk optimistically - merge directly into the transaction-local storage
-		gstate.table.GetStorage().LocalMerge(context.client, *lstate.local_collection);
-		gstate.table.GetStorage().FinalizeOptimisticWriter(context.client, *lstate.writer);
+		return SinkCombineResultType::FINISHED;
 	}
 
+	// we have written rows to disk optimistically - merge directly into the transaction-local storage
+	// the rows are appended to the transaction-local indexes after releasing the lock
+	// so that the threads construct their index entries in parallel
+	vector<unique_ptr<LocalIndexAppend>> index_appends;
+	auto index_append = storage.InitializeLocalIndexAppend(context.client, *lstate.local_collection);
+	{
+		lock_guard<mutex> lock(gstate.lock);
+		gstate.insert_count += append_count;
+		storage.LocalMerge(context.client, *lstate.local_collection, index_append.get());
+		storage.FinalizeOptimisticWriter(context.client, *lstate.writer);
+	}
+	if (index_append) {
+		index_appends.push_back(std::move(index_append));
+		storage.FinalizeLocalIndexAppends(context.client, index_appends);
+	}
 	return SinkCombineResultType::FINISHED;
 }
 
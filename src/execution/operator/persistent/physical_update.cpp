@@ -5,6 +5,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/materialized_view_maintenance.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -37,6 +38,8 @@ public:
 	idx_t updated_count;
 	unordered_set<row_t> updated_columns;
 	ColumnDataCollection return_collection;
+	//! Whether or not the updated rows have to be propagated to materialized views
+	bool track_views = false;
 };
 
 class UpdateLocalState : public LocalSinkState {
@@ -108,6 +111,11 @@ SinkResultType PhysicalUpdate::Sink(ExecutionContext &context, DataChunk &chunk,
 	}
 
 	lock_guard<mutex> glock(gstate.lock);
+	if (gstate.track_views) {
+		// capture the old version of the rows before they are changed
+		MaterializedViewMaintenance::Get(context.client)
+		    .AddUpdatedRows(context.client, tableref, row_ids, columns, update_chunk);
+	}
 	if (update_is_del_and_insert) {
 		// index update or update on complex type, perform a delete and an append instead
 
@@ -157,7 +165,9 @@ SinkResultType PhysicalUpdate::Sink(ExecutionContext &context, DataChunk &chunk,
 }
 
 unique_ptr<GlobalSinkState> PhysicalUpdate::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<UpdateGlobalState>(context, GetTypes());
+	auto result = make_uniq<UpdateGlobalState>(context, GetTypes());
+	result->track_views = MaterializedViewMaintenance::HasMaterializedViews(context, tableref);
+	return std::move(result);
 }
 
 unique_ptr<LocalSinkState> PhysicalUpdate::GetLocalSinkState(ExecutionContext &context) const {
@@ -96,7 +96,12 @@ SourceResultType PhysicalTableScan::GetData(ExecutionContext &context, DataChunk
 
 	TableFunctionInput data(bind_data.get(), state.local_state.get(), gstate.global_state.get());
 	if (function.function) {
+		data.interrupt_state = &input.interrupt_state;
 		function.function(context.client, data, chunk);
+		if (data.blocked) {
+			D_ASSERT(chunk.size() == 0);
+			return SourceResultType::BLOCKED;
+		}
 	} else {
 		if (gstate.in_out_final) {
 			function.in_out_function_final(context, data, chunk);
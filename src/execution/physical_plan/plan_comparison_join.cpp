@@ -1,7 +1,9 @@
 #include "duckdb/execution/operator/join/perfect_hash_join_executor.hpp"
+#include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
@@ -15,6 +17,9 @@
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 
 namespace duckdb {
 
@@ -156,9 +161,140 @@ bool PhysicalPlanGenerator::HasEquality(vector<JoinCondition> &conds, idx_t &ran
 	return false;
 }
 
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanIndexJoin(LogicalComparisonJoin &op, idx_t index_side) {
+	// we only consider inner joins with a single equality condition
+	if (op.type != LogicalOperatorType::LOGICAL_COMPARISON_JOIN || op.join_type != JoinType::INNER ||
+	    op.conditions.size() != 1 || op.conditions[0].comparison != ExpressionType::COMPARE_EQUAL) {
+		return nullptr;
+	}
+	// the indexed side has to be an unfiltered scan of a base table
+	auto &index_child = *op.children[index_side];
+	if (index_child.type != LogicalOperatorType::LOGICAL_GET) {
+		return nullptr;
+	}
+	auto &get = index_child.Cast<LogicalGet>();
+	if (get.function.name != "seq_scan" || !get.children.empty()) {
+		return nullptr;
+	}
+	auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan) {
+		return nullptr;
+	}
+	auto &table = bind_data.table;
+	auto &storage = table.GetStorage();
+
+	// the join key of the indexed side has to be a plain column of the table
+	auto &condition = op.conditions[0];
+	auto &index_key = index_side == 0 ? *condition.left : *condition.right;
+	auto &probe_key = index_side == 0 ? *condition.right : *condition.left;
+	if (index_key.type != ExpressionType::BOUND_REF) {
+		return nullptr;
+	}
+	auto &column_ids = get.GetColumnIds();
+	auto get_column_id = [&](idx_t get_idx) {
+		return get.projection_ids.empty() ? column_ids[get_idx] : column_ids[get.projection_ids[get_idx]];
+	};
+	auto key_column_id = get_column_id(index_key.Cast<BoundReferenceExpression>().index);
+	if (key_column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+	auto &key_column = table.GetColumn(LogicalIndex(key_column_id));
+	if (key_column.Generated() || probe_key.return_type != key_column.Type()) {
+		return nullptr;
+	}
+	// filters on the join key of the indexed table (e.g. derived from the statistics of the probe side) are
+	// equivalent to filters on the probe key, filters on other columns cannot be applied by the index join
+	vector<unique_ptr<Expression>> probe_filters;
+	for (auto &entry : get.table_filters.filters) {
+		if (entry.first != key_column_id) {
+			return nullptr;
+		}
+		probe_filters.push_back(entry.second->ToExpression(probe_key));
+	}
+
+	// every probe row costs an index lookup and a random fetch, so the probe side has to be small compared to the
+	// table: we use the same threshold as for index scans
+	auto &db_config = DBConfig::GetConfig(context);
+	auto probe_cardinality = op.children[1 - index_side]->EstimateCardinality(context);
+	auto total_rows = storage.GetTotalRows();
+	auto max_probe_count = MaxValue<idx_t>(
+	    db_config.options.index_scan_max_count,
+	    LossyNumericCast<idx_t>(double(total_rows) * db_config.options.index_scan_percentage));
+	if (MaxValue<idx_t>(probe_cardinality, 1) > max_probe_count) {
+		return nullptr;
+	}
+
+	// look for a unique ART index on exactly the join column, only unique indexes are also maintained for rows that
+	// are appended by the transaction
+	optional_ptr<ART> join_index;
+	auto &info = storage.GetDataTableInfo();
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art) {
+		if (art.GetConstraintType() == IndexConstraintType::NONE || art.unbound_expressions.size() != 1 ||
+		    art.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		if (art.GetColumnIds()[0] != key_column.StorageOid()) {
+			return false;
+		}
+		join_index = &art;
+		return true;
+	});
+	if (!join_index) {
+		return nullptr;
+	}
+
+	// we can use an index join: the projected columns of the indexed side are fetched from the table
+	auto &index_projection_map = index_side == 0 ? op.left_projection_map : op.right_projection_map;
+	vector<idx_t> fetch_map = index_projection_map;
+	if (fetch_map.empty()) {
+		for (idx_t i = 0; i < get.types.size(); i++) {
+			fetch_map.push_back(i);
+		}
+	}
+	vector<column_t> fetch_ids;
+	vector<LogicalType> fetch_types;
+	for (auto get_idx : fetch_map) {
+		auto column_id = get_column_id(get_idx);
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			fetch_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+		} else {
+			fetch_ids.push_back(table.GetColumn(LogicalIndex(column_id)).StorageOid());
+		}
+		fetch_types.push_back(get.types[get_idx]);
+	}
+
+	auto probe = CreatePlan(*op.children[1 - index_side]);
+	probe->estimated_cardinality = probe_cardinality;
+	if (!probe_filters.empty()) {
+		auto filter = make_uniq<PhysicalFilter>(probe->types, std::move(probe_filters), probe_cardinality);
+		filter->children.push_back(std::move(probe));
+		probe = std::move(filter);
+	}
+	vector<idx_t> probe_projection_map = index_side == 0 ? op.right_projection_map : op.left_projection_map;
+	if (probe_projection_map.empty()) {
+		for (idx_t i = 0; i < probe->types.size(); i++) {
+			probe_projection_map.push_back(i);
+		}
+	}
+	auto probe_expression = index_side == 0 ? std::move(condition.right) : std::move(condition.left);
+	return make_uniq<PhysicalIndexJoin>(op.types, std::move(probe), table, join_index->GetIndexName(),
+	                                    key_column.Name(), std::move(probe_expression), std::move(probe_projection_map),
+	                                    std::move(fetch_ids), std::move(fetch_types), index_side == 0,
+	                                    op.estimated_cardinality);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalComparisonJoin &op) {
 	// now visit the children
 	D_ASSERT(op.children.size() == 2);
+	// if one side is a small relation and the other side a large table with an index on the join key, we look up the
+	// rows of the small side in the index instead of scanning the table, we prefer probing the RHS
+	auto index_join = PlanIndexJoin(op, 1);
+	if (!index_join) {
+		index_join = PlanIndexJoin(op, 0);
+	}
+	if (index_join) {
+		return index_join;
+	}
 	idx_t lhs_cardinality = op.children[0]->EstimateCardinality(context);
 	idx_t rhs_cardinality = op.children[1]->EstimateCardinality(context);
 	auto left = CreatePlan(*op.children[0]);
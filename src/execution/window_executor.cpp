@@ -171,7 +171,7 @@ WindowInputColumn::WindowInputColumn(optional_ptr<Expression> expr_p, ClientCont
 	if (expr) {
 		vector<LogicalType> types;
 		types.emplace_back(expr->return_type);
-		wtarget.Initialize(Allocator::Get(context), types, count);
+		wtarget.Initialize(BufferAllocator::Get(context), types, count);
 		ptype = expr->return_type.InternalType();
 	}
 }
@@ -1066,7 +1066,7 @@ WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const Win
 		aggregator = make_uniq<WindowSegmentTree>(aggr, arg_types, return_type, mode, wexpr.exclude_clause);
 	}
 
-	gsink = aggregator->GetGlobalState(group_count, partition_mask);
+	gsink = aggregator->GetGlobalState(context, group_count, partition_mask);
 }
 
 unique_ptr<WindowExecutorGlobalState> WindowAggregateExecutor::GetGlobalState(const idx_t payload_count,
@@ -1434,7 +1434,7 @@ public:
 
 	{
 		if (!arg_types.empty()) {
-			payload_collection.Initialize(Allocator::Get(executor.context), arg_types, payload_count);
+			payload_collection.Initialize(BufferAllocator::Get(executor.context), arg_types, payload_count);
 		}
 
 		auto &wexpr = executor.wexpr;
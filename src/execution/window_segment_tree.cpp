@@ -20,13 +20,18 @@ namespace duckdb {
 WindowAggregatorState::WindowAggregatorState() : allocator(Allocator::DefaultAllocator()) {
 }
 
+WindowAggregatorState::WindowAggregatorState(Allocator &allocator) : allocator(allocator) {
+}
+
 class WindowAggregatorGlobalState : public WindowAggregatorState {
 public:
-	WindowAggregatorGlobalState(const WindowAggregator &aggregator_p, idx_t group_count)
-	    : aggregator(aggregator_p), winputs(inputs), locals(0), finalized(0) {
+	WindowAggregatorGlobalState(ClientContext &context, const WindowAggregator &aggregator_p, idx_t group_count)
+	    : WindowAggregatorState(BufferAllocator::Get(context)), aggregator(aggregator_p), winputs(inputs), locals(0),
+	      finalized(0) {
 
+		//	The partition data is allocated through the buffer manager so it counts towards the memory limit
 		if (!aggregator.arg_types.empty()) {
-			winputs.Initialize(Allocator::DefaultAllocator(), aggregator.arg_types, group_count);
+			winputs.Initialize(BufferAllocator::Get(context), aggregator.arg_types, group_count);
 		}
 		if (aggregator.aggr.filter) {
 			// 	Start with all invalid and set the ones that pass
@@ -63,8 +68,9 @@ WindowAggregator::WindowAggregator(AggregateObject aggr_p, const vector<LogicalT
 WindowAggregator::~WindowAggregator() {
 }
 
-unique_ptr<WindowAggregatorState> WindowAggregator::GetGlobalState(idx_t group_count, const ValidityMask &) const {
-	return make_uniq<WindowAggregatorGlobalState>(*this, group_count);
+unique_ptr<WindowAggregatorState> WindowAggregator::GetGlobalState(ClientContext &context, idx_t group_count,
+                                                                   const ValidityMask &) const {
+	return make_uniq<WindowAggregatorGlobalState>(context, *this, group_count);
 }
 
 void WindowAggregator::Sink(WindowAggregatorState &gsink, WindowAggregatorState &lstate, DataChunk &arg_chunk,
@@ -90,22 +96,23 @@ void WindowAggregator::Finalize(WindowAggregatorState &gstate, WindowAggregatorS
 //===--------------------------------------------------------------------===//
 struct WindowAggregateStates {
 	explicit WindowAggregateStates(const AggregateObject &aggr);
+	WindowAggregateStates(const AggregateObject &aggr, Allocator &state_allocator);
 	~WindowAggregateStates() {
 		Destroy();
 	}
 
 	//! The number of states
 	idx_t GetCount() const {
-		return states.size() / state_size;
+		return count;
 	}
 	data_ptr_t *GetData() {
 		return FlatVector::GetData<data_ptr_t>(*statef);
 	}
 	data_ptr_t GetStatePtr(idx_t idx) {
-		return states.data() + idx * state_size;
+		return states.get() + idx * state_size;
 	}
 	const_data_ptr_t GetStatePtr(idx_t idx) const {
-		return states.data() + idx * state_size;
+		return states.get() + idx * state_size;
 	}
 	//! Initialise all the states
 	void Initialize(idx_t count);
@@ -123,19 +130,30 @@ struct WindowAggregateStates {
 	const idx_t state_size;
 	//! The allocator to use
 	ArenaAllocator allocator;
+	//! The allocator for the state data
+	Allocator &state_allocator;
 	//! Data pointer that contains the state data
-	vector<data_t> states;
+	AllocatedData states;
+	//! The number of states
+	idx_t count = 0;
 	//! Reused result state container for the window functions
 	unique_ptr<Vector> statef;
 };
 
 WindowAggregateStates::WindowAggregateStates(const AggregateObject &aggr)
-    : aggr(aggr), state_size(aggr.function.state_size(aggr.function)), allocator(Allocator::DefaultAllocator()) {
+    : WindowAggregateStates(aggr, Allocator::DefaultAllocator()) {
+}
+
+WindowAggregateStates::WindowAggregateStates(const AggregateObject &aggr, Allocator &state_allocator)
+    : aggr(aggr), state_size(aggr.function.state_size(aggr.function)), allocator(Allocator::DefaultAllocator()),
+      state_allocator(state_allocator) {
 }
 
-void WindowAggregateStates::Initialize(idx_t count) {
-	states.resize(count * state_size);
-	auto state_ptr = states.data();
+void WindowAggregateStates::Initialize(idx_t count_p) {
+	D_ASSERT(!states.IsSet());
+	count = count_p;
+	states = state_allocator.Allocate(count * state_size);
+	auto state_ptr = states.get();
 
 	statef = make_uniq<Vector>(LogicalType::POINTER, count);
 	auto state_f_data = FlatVector::GetData<data_ptr_t>(*statef);
@@ -160,7 +178,7 @@ void WindowAggregateStates::Finalize(Vector &result) {
 }
 
 void WindowAggregateStates::Destroy() {
-	if (states.empty()) {
+	if (!states.IsSet()) {
 		return;
 	}
 
@@ -169,13 +187,14 @@ void WindowAggregateStates::Destroy() {
 		aggr.function.destructor(*statef, aggr_input_data, GetCount());
 	}
 
-	states.clear();
+	states.Reset();
+	count = 0;
 }
 
 class WindowConstantAggregatorGlobalState : public WindowAggregatorGlobalState {
 public:
-	WindowConstantAggregatorGlobalState(const WindowConstantAggregator &aggregator, idx_t count,
-	                                    const ValidityMask &partition_mask);
+	WindowConstantAggregatorGlobalState(ClientContext &context, const WindowConstantAggregator &aggregator,
+	                                    idx_t count, const ValidityMask &partition_mask);
 
 	void Finalize(const FrameStats &stats);
 
@@ -211,10 +230,12 @@ public:
 	SelectionVector matches;
 };
 
-WindowConstantAggregatorGlobalState::WindowConstantAggregatorGlobalState(const WindowConstantAggregator &aggregator,
+WindowConstantAggregatorGlobalState::WindowConstantAggregatorGlobalState(ClientContext &context,
+                                                                         const WindowConstantAggregator &aggregator,
                                                                          idx_t group_count,
                                                                          const ValidityMask &partition_mask)
-    : WindowAggregatorGlobalState(aggregator, STANDARD_VECTOR_SIZE), statef(aggregator.aggr) {
+    : WindowAggregatorGlobalState(context, aggregator, STANDARD_VECTOR_SIZE),
+      statef(aggregator.aggr, BufferAllocator::Get(context)) {
 
 	// Locate the partition boundaries
 	if (partition_mask.AllValid()) {
@@ -274,9 +295,9 @@ WindowConstantAggregator::WindowConstantAggregator(AggregateObject aggr, const v
     : WindowAggregator(std::move(aggr), arg_types, result_type, exclude_mode_p) {
 }
 
-unique_ptr<WindowAggregatorState> WindowConstantAggregator::GetGlobalState(idx_t group_count,
+unique_ptr<WindowAggregatorState> WindowConstantAggregator::GetGlobalState(ClientContext &context, idx_t group_count,
                                                                            const ValidityMask &partition_mask) const {
-	return make_uniq<WindowConstantAggregatorGlobalState>(*this, group_count, partition_mask);
+	return make_uniq<WindowConstantAggregatorGlobalState>(context, *this, group_count, partition_mask);
 }
 
 void WindowConstantAggregator::Sink(WindowAggregatorState &gsink, WindowAggregatorState &lstate, DataChunk &arg_chunk,
@@ -472,8 +493,9 @@ static void InitSubFrames(SubFrames &frames, const WindowExcludeMode exclude_mod
 
 class WindowCustomAggregatorGlobalState : public WindowAggregatorGlobalState {
 public:
-	explicit WindowCustomAggregatorGlobalState(const WindowCustomAggregator &aggregator, idx_t group_count)
-	    : WindowAggregatorGlobalState(aggregator, group_count) {
+	WindowCustomAggregatorGlobalState(ClientContext &context, const WindowCustomAggregator &aggregator,
+	                                  idx_t group_count)
+	    : WindowAggregatorGlobalState(context, aggregator, group_count) {
 
 		gcstate = make_uniq<WindowCustomAggregatorState>(aggregator.aggr, aggregator.exclude_mode);
 	}
@@ -503,9 +525,9 @@ WindowCustomAggregatorState::~WindowCustomAggregatorState() {
 	}
 }
 
-unique_ptr<WindowAggregatorState> WindowCustomAggregator::GetGlobalState(idx_t group_count,
+unique_ptr<WindowAggregatorState> WindowCustomAggregator::GetGlobalState(ClientContext &context, idx_t group_count,
                                                                          const ValidityMask &) const {
-	return make_uniq<WindowCustomAggregatorGlobalState>(*this, group_count);
+	return make_uniq<WindowCustomAggregatorGlobalState>(context, *this, group_count);
 }
 
 void WindowCustomAggregator::Finalize(WindowAggregatorState &gsink, WindowAggregatorState &lstate,
@@ -827,16 +849,18 @@ class WindowSegmentTreeGlobalState : public WindowAggregatorGlobalState {
 public:
 	using AtomicCounters = vector<std::atomic<idx_t>>;
 
-	WindowSegmentTreeGlobalState(const WindowSegmentTree &aggregator, idx_t group_count);
+	WindowSegmentTreeGlobalState(ClientContext &context, const WindowSegmentTree &aggregator, idx_t group_count);
 
 	ArenaAllocator &CreateTreeAllocator() {
 		lock_guard<mutex> tree_lock(lock);
-		tree_allocators.emplace_back(make_uniq<ArenaAllocator>(Allocator::DefaultAllocator()));
+		tree_allocators.emplace_back(make_uniq<ArenaAllocator>(buffer_allocator));
 		return *tree_allocators.back();
 	}
 
 	//! The owning aggregator
 	const WindowSegmentTree &tree;
+	//! The allocator for the tree nodes, which counts towards the memory limit
+	Allocator &buffer_allocator;
 	//! The actual window segment tree: an array of aggregate states that represent all the intermediate nodes
 	WindowAggregateStates levels_flat_native;
 	//! For each level, the starting location in the levels_flat_native array
@@ -986,9 +1010,9 @@ WindowSegmentTreePart::WindowSegmentTreePart(ArenaAllocator &allocator, const Ag
 WindowSegmentTreePart::~WindowSegmentTreePart() {
 }
 
-unique_ptr<WindowAggregatorState> WindowSegmentTree::GetGlobalState(idx_t group_count,
+unique_ptr<WindowAggregatorState> WindowSegmentTree::GetGlobalState(ClientContext &context, idx_t group_count,
                                                                     const ValidityMask &partition_mask) const {
-	return make_uniq<WindowSegmentTreeGlobalState>(*this, group_count);
+	return make_uniq<WindowSegmentTreeGlobalState>(context, *this, group_count);
 }
 
 unique_ptr<WindowAggregatorState> WindowSegmentTree::GetLocalState(const WindowAggregatorState &gstate) const {
@@ -1082,8 +1106,10 @@ void WindowSegmentTreePart::Finalize(Vector &result, idx_t count) {
 	}
 }
 
-WindowSegmentTreeGlobalState::WindowSegmentTreeGlobalState(const WindowSegmentTree &aggregator, idx_t group_count)
-    : WindowAggregatorGlobalState(aggregator, group_count), tree(aggregator), levels_flat_native(aggregator.aggr) {
+WindowSegmentTreeGlobalState::WindowSegmentTreeGlobalState(ClientContext &context, const WindowSegmentTree &aggregator,
+                                                           idx_t group_count)
+    : WindowAggregatorGlobalState(context, aggregator, group_count), tree(aggregator),
+      buffer_allocator(BufferAllocator::Get(context)), levels_flat_native(aggregator.aggr, buffer_allocator) {
 
 	D_ASSERT(inputs.ColumnCount() > 0);
 
@@ -1460,8 +1486,9 @@ public:
 
 WindowDistinctAggregatorGlobalState::WindowDistinctAggregatorGlobalState(const WindowDistinctAggregator &aggregator,
                                                                          idx_t group_count)
-    : WindowAggregatorGlobalState(aggregator, group_count), context(aggregator.context),
-      stage(PartitionSortStage::INIT), tasks_completed(0), levels_flat_native(aggregator.aggr) {
+    : WindowAggregatorGlobalState(aggregator.context, aggregator, group_count), context(aggregator.context),
+      stage(PartitionSortStage::INIT), tasks_completed(0),
+      levels_flat_native(aggregator.aggr, BufferAllocator::Get(aggregator.context)) {
 	payload_types.emplace_back(LogicalType::UBIGINT);
 
 	//	1:	functionComputePrevIdcs(𝑖𝑛)
@@ -1550,7 +1577,7 @@ WindowDistinctAggregatorLocalState::WindowDistinctAggregatorLocalState(
 	gastate.locals++;
 }
 
-unique_ptr<WindowAggregatorState> WindowDistinctAggregator::GetGlobalState(idx_t group_count,
+unique_ptr<WindowAggregatorState> WindowDistinctAggregator::GetGlobalState(ClientContext &context, idx_t group_count,
                                                                            const ValidityMask &partition_mask) const {
 	return make_uniq<WindowDistinctAggregatorGlobalState>(*this, group_count);
 }
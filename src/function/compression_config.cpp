@@ -19,6 +19,7 @@ static const DefaultCompressionMethod internal_compression_methods[] = {
     {CompressionType::COMPRESSION_UNCOMPRESSED, UncompressedFun::GetFunction, UncompressedFun::TypeIsSupported},
     {CompressionType::COMPRESSION_RLE, RLEFun::GetFunction, RLEFun::TypeIsSupported},
     {CompressionType::COMPRESSION_BITPACKING, BitpackingFun::GetFunction, BitpackingFun::TypeIsSupported},
+    {CompressionType::COMPRESSION_PFOR_DELTA, PForDeltaFun::GetFunction, PForDeltaFun::TypeIsSupported},
     {CompressionType::COMPRESSION_DICTIONARY, DictionaryCompressionFun::GetFunction,
      DictionaryCompressionFun::TypeIsSupported},
     {CompressionType::COMPRESSION_CHIMP, ChimpCompressionFun::GetFunction, ChimpCompressionFun::TypeIsSupported},
@@ -73,6 +74,7 @@ vector<reference<CompressionFunction>> DBConfig::GetCompressionFunctions(const P
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_UNCOMPRESSED, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_RLE, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_BITPACKING, physical_type);
+	TryLoadCompression(*this, result, CompressionType::COMPRESSION_PFOR_DELTA, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_DICTIONARY, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_CHIMP, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_PATAS, physical_type);
@@ -0,0 +1,135 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table_storage_info.hpp"
+
+namespace duckdb {
+
+struct DuckDBTableCompactionEntry {
+	DuckDBTableCompactionEntry(TableCatalogEntry &table, RowGroupCompactionInfo info) : table(table), info(info) {
+	}
+
+	TableCatalogEntry &table;
+	RowGroupCompactionInfo info;
+};
+
+struct DuckDBTableCompactionData : public GlobalTableFunctionState {
+	DuckDBTableCompactionData() : offset(0) {
+	}
+
+	vector<DuckDBTableCompactionEntry> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBTableCompactionBind(ClientContext &context, TableFunctionBindInput &input,
+                                                          vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("schema_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("table_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("row_group_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("total_rows");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("deleted_rows");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("deleted_fraction");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("can_compact");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("pending_row_groups");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("compacted_row_groups");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("compacted_rows");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBTableCompactionInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBTableCompactionData>();
+
+	// scan all the schemas for tables that are stored by DuckDB
+	auto schemas = Catalog::GetAllSchemas(context);
+	for (auto &schema : schemas) {
+		schema.get().Scan(context, CatalogType::TABLE_ENTRY, [&](CatalogEntry &entry) {
+			if (entry.type != CatalogType::TABLE_ENTRY) {
+				return;
+			}
+			auto &table = entry.Cast<TableCatalogEntry>();
+			if (!table.IsDuckTable()) {
+				return;
+			}
+			result->entries.emplace_back(table, table.GetStorage().GetCompactionInfo());
+		});
+	};
+	return std::move(result);
+}
+
+void DuckDBTableCompactionFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBTableCompactionData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		auto &table = entry.table;
+		auto &info = entry.info;
+		// return values:
+		idx_t col = 0;
+		// database_name, VARCHAR
+		output.SetValue(col++, count, table.catalog.GetName());
+		// schema_name, VARCHAR
+		output.SetValue(col++, count, Value(table.schema.name));
+		// table_name, VARCHAR
+		output.SetValue(col++, count, Value(table.name));
+		// row_group_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.row_group_count)));
+		// total_rows, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.total_rows)));
+		// deleted_rows, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.deleted_rows)));
+		// deleted_fraction, DOUBLE
+		auto deleted_fraction = info.total_rows == 0 ? 0.0
+		                                              : static_cast<double>(info.deleted_rows) /
+		                                                    static_cast<double>(info.total_rows);
+		output.SetValue(col++, count, Value::DOUBLE(deleted_fraction));
+		// can_compact, BOOLEAN
+		output.SetValue(col++, count, Value::BOOLEAN(info.can_compact));
+		// pending_row_groups, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.pending_row_groups)));
+		// compacted_row_groups, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.compacted_row_groups)));
+		// compacted_rows, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(info.compacted_rows)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBTableCompactionFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_table_compaction", {}, DuckDBTableCompactionFunction,
+	                              DuckDBTableCompactionBind, DuckDBTableCompactionInit));
+}
+
+} // namespace duckdb
@@ -18,6 +18,8 @@
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/transaction/local_storage.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -32,6 +34,9 @@ struct TableScanLocalState : public LocalTableFunctionState {
 	TableScanState scan_state;
 	//! The DataChunk containing all read columns (even filter columns that are immediately removed)
 	DataChunk all_columns;
+	//! The vector for which we last waited for asynchronous I/O
+	optional_ptr<RowGroup> io_row_group;
+	idx_t io_vector_index = DConstants::INVALID_INDEX;
 };
 
 static storage_t GetStorageIndex(TableCatalogEntry &table, column_t column_id) {
@@ -116,6 +121,45 @@ static unique_ptr<BaseStatistics> TableScanStatistics(ClientContext &context, co
 	return bind_data.table.GetStatistics(context, column_id);
 }
 
+//! If the blocks of the next vector have to be read from disk, schedules the reads on the I/O threads so the worker
+//! thread can execute other tasks in the meantime. Returns true if the scan should yield until the reads are done.
+static bool TableScanScheduleIO(ClientContext &context, TableFunctionInput &data_p, TableScanLocalState &state) {
+	if (!data_p.interrupt_state) {
+		return false;
+	}
+	auto &table_state = state.scan_state.table_state;
+	if (!table_state.row_group) {
+		return false;
+	}
+	if (state.io_row_group.get() == table_state.row_group && state.io_vector_index == table_state.vector_index) {
+		// we already waited for the I/O of this vector - scan it, even if some blocks were evicted in the meantime
+		return false;
+	}
+	PrefetchState prefetch_state;
+	table_state.InitializePrefetch(prefetch_state);
+	bool requires_io = false;
+	for (auto &block : prefetch_state.blocks) {
+		if (block->IsUnloaded()) {
+			requires_io = true;
+			break;
+		}
+	}
+	if (!requires_io) {
+		return false;
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	auto blocks = std::move(prefetch_state.blocks);
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	if (!scheduler.ScheduleIO([&buffer_manager, blocks]() mutable { buffer_manager.Prefetch(blocks); },
+	                          *data_p.interrupt_state)) {
+		// asynchronous I/O is disabled
+		return false;
+	}
+	state.io_row_group = table_state.row_group;
+	state.io_vector_index = table_state.vector_index;
+	return true;
+}
+
 static void TableScanFunc(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
 	auto &gstate = data_p.global_state->Cast<TableScanGlobalState>();
@@ -125,6 +169,10 @@ static void TableScanFunc(ClientContext &context, TableFunctionInput &data_p, Da
 
 	state.scan_state.options.force_fetch_row = ClientConfig::GetConfig(context).force_fetch_row;
 	do {
+		if (!bind_data.is_create_index && TableScanScheduleIO(context, data_p, state)) {
+			data_p.blocked = true;
+			return;
+		}
 		if (bind_data.is_create_index) {
 			storage.CreateIndexScan(state.scan_state, output,
 			                        TableScanType::TABLE_SCAN_COMMITTED_ROWS_OMIT_PERMANENTLY_DELETED);
@@ -272,6 +320,81 @@ static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Row Id Fetch
+//===--------------------------------------------------------------------===//
+struct RowIdFetchGlobalState : public GlobalTableFunctionState {
+	vector<storage_t> column_ids;
+};
+
+struct RowIdFetchLocalState : public LocalTableFunctionState {
+	ColumnFetchState fetch_state;
+	DataChunk fetch_chunk;
+};
+
+static unique_ptr<GlobalTableFunctionState> RowIdFetchInitGlobal(ClientContext &context,
+                                                                 TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
+	auto result = make_uniq<RowIdFetchGlobalState>();
+	for (auto &id : input.column_ids) {
+		result->column_ids.push_back(GetStorageIndex(bind_data.table, id));
+	}
+	return std::move(result);
+}
+
+static unique_ptr<LocalTableFunctionState> RowIdFetchInitLocal(ExecutionContext &context,
+                                                               TableFunctionInitInput &input,
+                                                               GlobalTableFunctionState *gstate) {
+	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
+	auto result = make_uniq<RowIdFetchLocalState>();
+	vector<LogicalType> types;
+	for (auto &id : input.column_ids) {
+		if (id == COLUMN_IDENTIFIER_ROW_ID) {
+			types.emplace_back(LogicalType::ROW_TYPE);
+		} else {
+			types.push_back(bind_data.table.GetColumn(LogicalIndex(id)).Type());
+		}
+	}
+	result->fetch_chunk.Initialize(context.client, types);
+	return std::move(result);
+}
+
+static OperatorResultType RowIdFetchFunction(ExecutionContext &context, TableFunctionInput &data_p, DataChunk &input,
+                                             DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
+	auto &gstate = data_p.global_state->Cast<RowIdFetchGlobalState>();
+	auto &state = data_p.local_state->Cast<RowIdFetchLocalState>();
+	auto &transaction = DuckTransaction::Get(context.client, bind_data.table.catalog);
+	auto &storage = bind_data.table.GetStorage();
+
+	// the row ids are the last column of the input
+	auto &row_ids = input.data.back();
+	row_ids.Flatten(input.size());
+	auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+	bool has_local_rows = false;
+	for (idx_t i = 0; i < input.size(); i++) {
+		has_local_rows = has_local_rows || row_id_data[i] >= MAX_ROW_ID;
+	}
+	if (!has_local_rows) {
+		storage.Fetch(transaction, output, gstate.column_ids, row_ids, input.size(), state.fetch_state);
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+	// rows that were appended by this transaction have to be fetched from the transaction-local storage
+	// we fetch the rows one-by-one to preserve the order of the input
+	auto &local_storage = LocalStorage::Get(transaction);
+	for (idx_t i = 0; i < input.size(); i++) {
+		Vector row_id(row_ids, i, i + 1);
+		state.fetch_chunk.Reset();
+		if (row_id_data[i] >= MAX_ROW_ID) {
+			local_storage.FetchChunk(storage, row_id, 1, gstate.column_ids, state.fetch_chunk, state.fetch_state);
+		} else {
+			storage.Fetch(transaction, state.fetch_chunk, gstate.column_ids, row_id, 1, state.fetch_state);
+		}
+		output.Append(state.fetch_chunk);
+	}
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
 static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &expr, bool &rewrite_possible) {
 	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
 		auto &bound_colref = expr.Cast<BoundColumnRefExpression>();
@@ -422,6 +545,21 @@ TableFunction TableScanFunction::GetIndexScanFunction() {
 	return scan_function;
 }
 
+TableFunction TableScanFunction::GetRowIdFetchFunction() {
+	TableFunction fetch_function("row_id_fetch", {}, nullptr);
+	fetch_function.in_out_function = RowIdFetchFunction;
+	fetch_function.init_global = RowIdFetchInitGlobal;
+	fetch_function.init_local = RowIdFetchInitLocal;
+	fetch_function.statistics = TableScanStatistics;
+	fetch_function.dependency = TableScanDependency;
+	fetch_function.to_string = TableScanToString;
+	fetch_function.get_bind_info = TableScanGetBindInfo;
+	fetch_function.projection_pushdown = true;
+	fetch_function.serialize = TableScanSerialize;
+	fetch_function.deserialize = TableScanDeserialize;
+	return fetch_function;
+}
+
 TableFunction TableScanFunction::GetFunction() {
 	TableFunction scan_function("seq_scan", {}, TableScanFunc);
 	scan_function.init_local = TableScanInitLocal;
@@ -448,6 +586,7 @@ void TableScanFunction::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(std::move(table_scan_set));
 
 	set.AddFunction(GetIndexScanFunction());
+	set.AddFunction(GetRowIdFetchFunction());
 }
 
 void BuiltinFunctions::RegisterTableScanFunctions() {
@@ -90,6 +90,9 @@ public:
 	          const std::function<void(CatalogEntry &, CatalogEntry &, const DependencyDependentFlags &)> &callback);
 
 	void AddOwnership(CatalogTransaction transaction, CatalogEntry &owner, CatalogEntry &entry);
+	//! Scans the entries that depend on the given entry
+	void ScanDependentEntries(CatalogTransaction transaction, CatalogEntry &entry,
+	                          const std::function<void(CatalogEntry &)> &callback);
 
 private:
 	DuckCatalog &catalog;
@@ -38,6 +38,7 @@ enum class OptimizerType : uint32_t {
 	JOIN_FILTER_PUSHDOWN,
 	EXTENSION,
 	MATERIALIZED_CTE,
+	LATE_MATERIALIZATION,
 };
 
 string OptimizerTypeToString(OptimizerType type);
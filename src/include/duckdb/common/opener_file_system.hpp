@@ -38,6 +38,10 @@ public:
 		GetFileSystem().Write(handle, buffer, nr_bytes, location);
 	}
 
+	void ReadBatch(FileHandle &handle, const vector<FileReadRequest> &requests) override {
+		GetFileSystem().ReadBatch(handle, requests);
+	}
+
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override {
 		return GetFileSystem().Read(handle, buffer, nr_bytes);
 	}
@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/resource_counters.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! A snapshot of the resources used by a thread
+struct ResourceCounterSnapshot {
+	//! Net amount of memory reserved in the buffer pool
+	int64_t memory_reserved = 0;
+	//! Bytes written to/read from temporary files
+	idx_t temp_bytes_written = 0;
+	idx_t temp_bytes_read = 0;
+	//! Bytes read from the database file(s)
+	idx_t storage_bytes_read = 0;
+	//! Pins of blocks that were (not) already loaded in the buffer pool
+	idx_t buffer_hits = 0;
+	idx_t buffer_misses = 0;
+	//! Hardware counters, only filled in if requested and supported
+	idx_t cpu_cycles = 0;
+	idx_t instructions = 0;
+	idx_t llc_misses = 0;
+	idx_t branch_misses = 0;
+};
+
+//! ThreadResourceCounters counts the resources that are used by the current thread. The counters are updated by the
+//! buffer manager and the block manager, the OperatorProfiler attributes the difference between two snapshots to the
+//! operator that was active in between.
+class ThreadResourceCounters {
+public:
+	static void AddMemoryReserved(int64_t bytes);
+	static void AddTemporaryBytesWritten(idx_t bytes);
+	static void AddTemporaryBytesRead(idx_t bytes);
+	static void AddStorageBytesRead(idx_t bytes);
+	static void AddBufferHit();
+	static void AddBufferMiss();
+
+	//! Take a snapshot of the counters of the current thread, optionally including the hardware counters
+	static ResourceCounterSnapshot Snapshot(bool hardware_counters);
+	//! Resets the peak of the memory reserved by the current thread to the current value
+	static void ResetPeakMemory();
+	//! The peak of the memory reserved by the current thread since the last call to ResetPeakMemory
+	static int64_t PeakMemory();
+	//! Whether or not hardware counters (perf_event on Linux) can be read by the current thread
+	static bool HardwareCountersSupported();
+};
+
+} // namespace duckdb
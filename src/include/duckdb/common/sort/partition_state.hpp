@@ -12,6 +12,7 @@
 #include "duckdb/common/types/column/partitioned_column_data.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 
 namespace duckdb {
 
@@ -70,6 +71,8 @@ public:
 
 	void UpdateLocalPartition(GroupingPartition &local_partition, GroupingAppend &local_append);
 	void CombineLocalPartition(GroupingPartition &local_partition, GroupingAppend &local_append);
+	//! Reserve memory for sorting the partitions, switching to an external sort if the data does not fit
+	void ReserveMergeMemory();
 
 	virtual void OnBeginMerge() {};
 	virtual void OnSortedPartition(const idx_t hash_bin_p) {};
@@ -99,6 +102,9 @@ public:
 	unique_ptr<RowDataCollection> rows;
 	unique_ptr<RowDataCollection> strings;
 
+	//! The memory reservation for sorting and evaluating the partitions
+	unique_ptr<TemporaryMemoryState> temporary_memory_state;
+
 	// Threading
 	idx_t memory_per_thread;
 	idx_t max_bits;
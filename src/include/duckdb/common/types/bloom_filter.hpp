@@ -0,0 +1,86 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+
+namespace duckdb {
+class Vector;
+class Serializer;
+class Deserializer;
+
+//! The BloomFilter class is a split-block Bloom filter over pre-computed 64-bit hashes.
+//! Every hash maps to a single 32-byte block (which fits in a cache line), in which 8 bits are set - one per word.
+//! A probe therefore touches exactly one cache line. The layout and bit selection match the Parquet split-block Bloom
+//! filter specification.
+class BloomFilter {
+public:
+	//! The amount of 32-bit words in a block
+	static constexpr const idx_t WORDS_PER_BLOCK = 8;
+	//! The size of a block in bytes
+	static constexpr const idx_t BLOCK_SIZE = WORDS_PER_BLOCK * sizeof(uint32_t);
+
+public:
+	//! Creates an empty Bloom filter with the given amount of blocks (must be a power of two)
+	explicit BloomFilter(idx_t block_count);
+	// implicit copying of BloomFilter is not allowed
+	BloomFilter(const BloomFilter &) = delete;
+
+	//! Returns the amount of blocks required to store "capacity" distinct keys using (approximately) "bits_per_key" bits
+	//! per key, rounded up to a power of two and capped at "max_block_count"
+	static idx_t GetBlockCount(idx_t capacity, idx_t bits_per_key, idx_t max_block_count);
+	//! Returns the estimated false positive rate of this filter after inserting "key_count" distinct keys
+	double EstimatedFalsePositiveRate(idx_t key_count) const;
+	//! Returns the false positive rate of this filter based on the bits that are currently set
+	double FalsePositiveRate() const;
+	//! Halves the size of the filter as long as the false positive rate stays below "max_false_positive_rate"
+	void Shrink(double max_false_positive_rate);
+
+	//! Inserts a single hash
+	void Insert(hash_t hash);
+	//! Returns false if the hash was definitely not inserted, true if it might have been
+	bool Contains(hash_t hash) const;
+	//! Inserts the hashes (flat vector of type HASH) referenced by the selection vector
+	void Insert(Vector &hashes, const SelectionVector &sel, idx_t count);
+	//! Probes the hashes (flat vector of type HASH) referenced by the selection vector, and writes the indices of the
+	//! hashes that might be present to "result". Returns the amount of entries written.
+	idx_t Probe(Vector &hashes, const SelectionVector &sel, idx_t count, SelectionVector &result) const;
+	//! Merges another Bloom filter with the same amount of blocks into this one
+	void Merge(const BloomFilter &other);
+
+	void Serialize(Serializer &serializer) const;
+	static shared_ptr<BloomFilter> Deserialize(Deserializer &deserializer);
+
+	idx_t BlockCount() const {
+		return block_count;
+	}
+	idx_t SizeInBytes() const {
+		return block_count * BLOCK_SIZE;
+	}
+	data_ptr_t GetData() {
+		return data_ptr_cast(blocks.get());
+	}
+	const_data_ptr_t GetData() const {
+		return const_data_ptr_cast(blocks.get());
+	}
+
+private:
+	inline uint32_t *GetBlock(hash_t hash) const {
+		// use the upper 32 bits of the hash to select the block
+		auto block_idx = ((hash >> 32) * block_count) >> 32;
+		return blocks.get() + block_idx * WORDS_PER_BLOCK;
+	}
+
+private:
+	idx_t block_count;
+	unsafe_unique_array<uint32_t> blocks;
+};
+
+} // namespace duckdb
@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/compiled_expression.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+
+namespace duckdb {
+class Expression;
+struct CompiledInstruction;
+
+//! A kernel computes the result register of an instruction for the current tile, returns false if it fails (e.g. on
+//! an overflow)
+typedef bool (*compiled_kernel_t)(data_ptr_t *registers, const CompiledInstruction &instruction, idx_t count);
+
+//! A single operation of a compiled expression
+struct CompiledInstruction {
+	compiled_kernel_t kernel;
+	idx_t result;
+	idx_t arguments[3];
+};
+
+enum class CompiledRegisterType : uint8_t { INPUT_COLUMN, CONSTANT, INTERMEDIATE };
+
+//! A register holds the values of one node of the expression tree for the current tile
+struct CompiledRegister {
+	CompiledRegisterType type;
+	PhysicalType physical_type;
+	//! The column of the input chunk (for INPUT_COLUMN registers)
+	idx_t column_index;
+};
+
+//! A CompiledExpression fuses a tree of scalar expressions over fixed-width types (arithmetic, comparisons, conjunctions,
+//! CASE and widening casts) into a flat sequence of tight loops. The loops are run tile-by-tile over the input chunk, so
+//! the intermediates stay in the CPU cache instead of being materialized in a Vector per expression node. The compiled
+//! expression only handles chunks without NULL values; if a chunk has NULL values, or an arithmetic operation
+//! overflows, it reports failure and the expression is interpreted by the ExpressionExecutor instead.
+class CompiledExpression {
+public:
+	//! The amount of rows that are processed by all instructions before moving on to the next tile
+	static constexpr const idx_t TILE_SIZE = 256;
+	//! Expressions with fewer operations are not compiled, as there is nothing to fuse
+	static constexpr const idx_t MINIMUM_INSTRUCTIONS = 2;
+
+public:
+	//! Compiles the expression, returns nullptr if (part of) the expression cannot be compiled
+	static unique_ptr<CompiledExpression> Compile(const Expression &expr);
+
+	//! Evaluates the expression over the input chunk and writes the result to the (flat) result vector. Returns false
+	//! if the chunk could not be evaluated, in which case the expression has to be interpreted instead.
+	bool Execute(DataChunk &input, Vector &result);
+	//! Evaluates a boolean expression over the input chunk and fills in the selection vectors with the rows for which
+	//! it is true/false. Returns false if the chunk could not be evaluated.
+	bool Select(DataChunk &input, SelectionVector *true_sel, SelectionVector *false_sel, idx_t &true_count);
+
+private:
+	CompiledExpression() = default;
+
+	idx_t AddRegister(CompiledRegisterType type, PhysicalType physical_type, idx_t column_index = 0);
+	idx_t CompileNode(const Expression &expr);
+	void AddInstruction(compiled_kernel_t kernel, idx_t result, idx_t arg0, idx_t arg1 = 0, idx_t arg2 = 0);
+	void AllocateRegisters();
+
+	//! Checks the input columns for NULL values and converts them to the unified format
+	bool PrepareInput(DataChunk &input);
+	//! Points (or copies) the input columns of the given tile into their registers
+	void LoadTile(idx_t start, idx_t count);
+	bool ExecuteTile(idx_t count);
+
+private:
+	vector<CompiledRegister> register_info;
+	vector<CompiledInstruction> instructions;
+	//! The constant values, in the order of the constant registers
+	vector<Value> constants;
+	//! The register that holds the result of the expression
+	idx_t root = 0;
+	//! The buffer of each register
+	unsafe_unique_array<data_t> register_memory;
+	vector<data_ptr_t> register_buffers;
+	//! The data of each register for the current tile, either the buffer or the data of a flat input column
+	vector<data_ptr_t> registers;
+	//! The input columns in the unified format
+	vector<UnifiedVectorFormat> input_formats;
+	vector<bool> input_is_flat;
+};
+
+} // namespace duckdb
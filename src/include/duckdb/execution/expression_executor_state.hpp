@@ -13,6 +13,7 @@
 #include "duckdb/function/function.hpp"
 
 namespace duckdb {
+class CompiledExpression;
 class Expression;
 class ExpressionExecutor;
 struct ExpressionExecutorState;
@@ -65,9 +66,12 @@ public:
 
 struct ExpressionExecutorState {
 	ExpressionExecutorState();
+	~ExpressionExecutorState();
 
 	unique_ptr<ExpressionState> root_state;
 	ExpressionExecutor *executor = nullptr;
+	//! The compiled version of the expression, if it could be compiled
+	unique_ptr<CompiledExpression> compiled_expression;
 
 	void Verify();
 };
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "duckdb/common/types/bloom_filter.hpp"
+#include "duckdb/common/types/vector.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/column_binding.hpp"
@@ -15,6 +17,7 @@
 namespace duckdb {
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
@@ -30,22 +33,42 @@ struct JoinFilterGlobalState {
 
 	//! Global Min/Max aggregates for filter pushdown
 	unique_ptr<GlobalUngroupedAggregateState> global_aggregate_state;
+	//! Lock protecting the global Bloom filters
+	mutex lock;
+	//! Global Bloom filters for filter pushdown (one per filter, empty if no Bloom filters are built)
+	vector<shared_ptr<BloomFilter>> bloom_filters;
 };
 
 struct JoinFilterLocalState {
+	JoinFilterLocalState();
 	~JoinFilterLocalState();
 
 	//! Local Min/Max aggregates for filter pushdown
 	unique_ptr<LocalUngroupedAggregateState> local_aggregate_state;
+	//! Local Bloom filters for filter pushdown (one per filter, empty if no Bloom filters are built)
+	vector<unique_ptr<BloomFilter>> bloom_filters;
+	//! Hashes of the join keys that are inserted into the Bloom filters
+	Vector hashes;
 };
 
 struct JoinFilterPushdownInfo {
+	//! The maximum amount of build-side rows for which an exact IN filter is pushed instead of a Bloom filter
+	static constexpr const idx_t IN_FILTER_THRESHOLD = 50;
+	//! The amount of bits per build-side key used when sizing the Bloom filters
+	static constexpr const idx_t BLOOM_FILTER_BITS_PER_KEY = 16;
+	//! The maximum amount of blocks of a Bloom filter (2MB) - every sink thread holds its own copy
+	static constexpr const idx_t BLOOM_FILTER_MAX_BLOCKS = 65536;
+	//! Bloom filters are only pushed if their estimated false positive rate is below this threshold
+	static constexpr const double BLOOM_FILTER_MAX_FALSE_POSITIVE_RATE = 0.1;
+
 	//! The dynamic table filter set where to push filters into
 	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 	//! The filters that we should generate
 	vector<JoinFilterPushdownColumn> filters;
 	//! Min/Max aggregates
 	vector<unique_ptr<Expression>> min_max_aggregates;
+	//! Whether or not to build and push Bloom filters over the build-side keys
+	bool build_bloom_filters = false;
 
 public:
 	unique_ptr<JoinFilterGlobalState> GetGlobalState(ClientContext &context, const PhysicalOperator &op) const;
@@ -53,7 +76,10 @@ public:
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	void PushFilters(JoinHashTable &ht, JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+
+private:
+	bool PushInFilter(JoinHashTable &ht, const PhysicalOperator &op, idx_t filter_idx) const;
 };
 
 } // namespace duckdb
@@ -21,6 +21,8 @@ namespace duckdb {
 class PhysicalHashJoin : public PhysicalComparisonJoin {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::HASH_JOIN;
+	//! The factor by which the actual build-side cardinality must differ from the estimate to be reported
+	static constexpr const idx_t BUILD_MISESTIMATE_THRESHOLD = 100;
 
 public:
 	PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
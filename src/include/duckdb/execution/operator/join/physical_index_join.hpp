@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_index_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+
+class DuckTableEntry;
+
+//! PhysicalIndexJoin represents an inner equi-join where one side is a base table with an ART index on the join key.
+//! Instead of building a hash table, every chunk of the probe side is looked up in the ART, and the matching rows
+//! are fetched from the table by their row ids.
+class PhysicalIndexJoin : public CachingPhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::INDEX_JOIN;
+
+public:
+	PhysicalIndexJoin(vector<LogicalType> types, unique_ptr<PhysicalOperator> probe, DuckTableEntry &table,
+	                  string index_name, string index_column_name, unique_ptr<Expression> probe_key,
+	                  vector<idx_t> probe_projection_map, vector<column_t> fetch_ids, vector<LogicalType> fetch_types,
+	                  bool fetch_first, idx_t estimated_cardinality);
+
+	//! The indexed table
+	DuckTableEntry &table;
+	//! The name of the ART index that is probed
+	string index_name;
+	//! The name of the indexed column (for EXPLAIN)
+	string index_column_name;
+	//! The join key of the probe side
+	unique_ptr<Expression> probe_key;
+	//! The columns of the probe side that are part of the result
+	vector<idx_t> probe_projection_map;
+	//! The (storage) column ids that are fetched from the indexed table
+	vector<column_t> fetch_ids;
+	//! The types of the fetched columns
+	vector<LogicalType> fetch_types;
+	//! Whether the fetched columns come before the probe columns in the result, i.e. the indexed table was the LHS
+	bool fetch_first;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+	InsertionOrderPreservingMap<string> ParamsToString() const override;
+
+protected:
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+};
+
+} // namespace duckdb
@@ -22,6 +22,7 @@ class ColumnData;
 class ColumnDataCheckpointer;
 class ColumnSegment;
 class SegmentStatistics;
+class TableFilter;
 struct ColumnSegmentState;
 
 struct ColumnFetchState;
@@ -169,6 +170,12 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for evaluating a table filter on the compressed data of an entire vector. The rows in 'sel'
+//! that pass the filter are kept in 'sel', and only their values are written to the (flat) result vector. NULL values
+//! are not taken into account. Returns false without scanning anything if the filter is not supported.
+typedef bool (*compression_filter_t)(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                     Vector &result, SelectionVector &sel, idx_t &sel_count,
+                                     const TableFilter &filter);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -206,13 +213,14 @@ public:
 	                    compression_serialize_state_t serialize_state = nullptr,
 	                    compression_deserialize_state_t deserialize_state = nullptr,
 	                    compression_cleanup_state_t cleanup_state = nullptr,
-	                    compression_init_prefetch_t init_prefetch = nullptr)
+	                    compression_init_prefetch_t init_prefetch = nullptr,
+	                    compression_filter_t filter = nullptr)
 	    : type(type), data_type(data_type), init_analyze(init_analyze), analyze(analyze), final_analyze(final_analyze),
 	      init_compression(init_compression), compress(compress), compress_finalize(compress_finalize),
 	      init_prefetch(init_prefetch), init_scan(init_scan), scan_vector(scan_vector), scan_partial(scan_partial),
 	      fetch_row(fetch_row), skip(skip), init_segment(init_segment), init_append(init_append), append(append),
 	      finalize_append(finalize_append), revert_append(revert_append), serialize_state(serialize_state),
-	      deserialize_state(deserialize_state), cleanup_state(cleanup_state) {
+	      deserialize_state(deserialize_state), cleanup_state(cleanup_state), filter(filter) {
 	}
 
 	//! Compression type
@@ -280,6 +288,9 @@ public:
 	compression_deserialize_state_t deserialize_state;
 	//! Cleanup the segment state (optional)
 	compression_cleanup_state_t cleanup_state;
+
+	//! Evaluate a table filter directly on the compressed data, without decompressing filtered out rows (optional)
+	compression_filter_t filter;
 };
 
 //! The set of compression functions
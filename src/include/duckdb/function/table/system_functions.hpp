@@ -105,6 +105,10 @@ struct DuckDBTablesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBTableCompactionFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBTemporaryFilesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -42,6 +42,8 @@ struct TableScanFunction {
 	static void RegisterFunction(BuiltinFunctions &set);
 	static TableFunction GetFunction();
 	static TableFunction GetIndexScanFunction();
+	//! Fetches the columns of the rows identified by the row ids in the last column of its input
+	static TableFunction GetRowIdFetchFunction();
 };
 
 } // namespace duckdb
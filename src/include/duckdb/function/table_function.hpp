@@ -21,6 +21,7 @@
 namespace duckdb {
 
 class BaseStatistics;
+class InterruptState;
 class LogicalDependencyList;
 class LogicalGet;
 class TableFilterSet;
@@ -137,6 +138,11 @@ public:
 	optional_ptr<const FunctionData> bind_data;
 	optional_ptr<LocalTableFunctionState> local_state;
 	optional_ptr<GlobalTableFunctionState> global_state;
+	//! The interrupt state of the calling task - only set if the function is allowed to yield on I/O
+	optional_ptr<InterruptState> interrupt_state;
+	//! Set by the function if it returns no data because it is waiting for I/O to complete
+	//! The function is called again after the callback of the interrupt state has been made
+	bool blocked = false;
 };
 
 enum class ScanType : uint8_t { TABLE, PARQUET };
@@ -73,6 +73,8 @@ struct ClientConfig {
 	bool enable_optimizer = true;
 	//! Enable caching operators
 	bool enable_caching_operators = true;
+	//! Enable the compilation of scalar expressions into fused loops
+	bool enable_compiled_expressions = true;
 	//! Force parallelism of small tables, used for testing
 	bool verify_parallelism = false;
 	//! Force out-of-core computation for operators that support it, used for testing
@@ -23,6 +23,7 @@ class CatalogSearchPath;
 class FileOpener;
 class FileSystem;
 class HTTPState;
+class MaterializedViewMaintenance;
 class QueryProfiler;
 class PreparedStatementData;
 class SchemaCatalogEntry;
@@ -58,6 +59,9 @@ struct ClientData {
 	//! The clients' file system wrapper
 	unique_ptr<FileSystem> client_file_system;
 
+	//! The changes of the current statement that have to be propagated to materialized views
+	unique_ptr<MaterializedViewMaintenance> materialized_view_maintenance;
+
 	//! The file search path
 	string file_search_path;
 
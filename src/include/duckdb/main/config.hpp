@@ -124,6 +124,14 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! The time (in microseconds) a commit waits before syncing the WAL, to sync it together with concurrent commits
+	idx_t wal_commit_delay = 0;
+	//! Whether or not commits return before their changes are synced to disk
+	bool wal_async_commit = false;
+	//! The fraction of deleted rows at which a checkpoint rewrites a row group to remove the deleted rows
+	double compaction_threshold = 0.5;
+	//! The maximum number of rows a checkpoint rewrites per table to remove deleted rows (0 means no limit)
+	idx_t compaction_row_limit = 0;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -153,10 +161,15 @@ struct DBConfigOptions {
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
 	//! Must be smaller or equal to maximum_threads.
 	idx_t external_threads = 1;
+	//! The number of threads that perform I/O on behalf of scans that yield instead of blocking on I/O. Default: 0.
+	//! When set to 0, scans perform their I/O on the worker thread.
+	idx_t async_io_threads = 0;
 	//! Whether or not to create and use a temporary directory to store intermediates that do not fit in memory
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! Whether or not to compress the blocks that are written to the temporary files
+	bool temp_file_compression = false;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
@@ -174,6 +187,10 @@ struct DBConfigOptions {
 	bool enable_external_access = true;
 	//! Whether or not object cache is used
 	bool object_cache_enable = false;
+	//! Whether or not the results of repeated queries are cached
+	bool enable_query_result_cache = false;
+	//! The maximum amount of memory used by the query result cache (1 << 26, 64MB)
+	idx_t query_result_cache_limit = 1 << 26;
 	//! Whether or not the global http metadata cache is used
 	bool http_metadata_cache_enable = false;
 	//! Force checkpoint when CHECKPOINT is called or on shutdown, even if no changes have been made
@@ -0,0 +1,95 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/materialized_view_maintenance.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+
+namespace duckdb {
+class ClientContext;
+class MaterializedQueryResult;
+class QueryNode;
+class SQLStatement;
+class TableCatalogEntry;
+class TableRef;
+struct PhysicalIndex;
+
+//! The changes made by the current statement to a table that is read by materialized views
+struct MaterializedViewDelta {
+	explicit MaterializedViewDelta(TableCatalogEntry &table) : table(table) {
+	}
+
+	TableCatalogEntry &table;
+	//! The rows that were inserted into the table
+	shared_ptr<ColumnDataCollection> inserted;
+	//! The rows that were deleted from the table
+	shared_ptr<ColumnDataCollection> deleted;
+	//! The row ids of the deleted (or updated) rows
+	unordered_set<row_t> deleted_row_ids;
+	//! Whether or not the changes could not be captured, in which case the views are recomputed from scratch
+	bool requires_refresh = false;
+};
+
+//! Executes a statement as part of the current transaction, and returns its (materialized) result
+typedef std::function<unique_ptr<MaterializedQueryResult>(unique_ptr<SQLStatement> statement)> maintenance_execute_t;
+
+//! MaterializedViewMaintenance collects the rows that a statement inserts into and deletes from tables that are read
+//! by materialized views, and propagates these deltas to the views before the statement finishes. The deltas are
+//! pushed through the query of the view by replacing the changed table with the delta: new rows of select-project-join
+//! views are appended, and SUM/COUNT aggregates are merged into the existing groups. Changes that cannot be propagated
+//! incrementally recompute the affected groups, or the entire view.
+class MaterializedViewMaintenance {
+public:
+	DUCKDB_API static MaterializedViewMaintenance &Get(ClientContext &context);
+
+	//! Whether or not changes to the table have to be propagated to materialized views
+	static bool HasMaterializedViews(ClientContext &context, TableCatalogEntry &table);
+	//! Throws an exception if the table is a materialized view that is not currently being maintained
+	static void VerifyModification(ClientContext &context, TableCatalogEntry &table);
+
+	//! Records rows that are inserted into the table
+	void AddInsertedRows(ClientContext &context, TableCatalogEntry &table, DataChunk &chunk);
+	//! Records rows that are about to be deleted from the table
+	void AddDeletedRows(ClientContext &context, TableCatalogEntry &table, Vector &row_ids, idx_t count);
+	//! Records rows that are about to be updated, as a deletion of the old rows and an insertion of the new rows
+	void AddUpdatedRows(ClientContext &context, TableCatalogEntry &table, Vector &row_ids,
+	                    const vector<PhysicalIndex> &columns, DataChunk &updates);
+	//! Marks the table as changed in a way that is not captured, the views are recomputed from scratch
+	void RequireRefresh(ClientContext &context, TableCatalogEntry &table);
+
+	//! Whether or not there are changes that have to be propagated
+	bool HasChanges();
+	//! Discards the recorded changes
+	void Clear();
+	//! Whether or not the views are currently being maintained
+	bool IsMaintaining() const {
+		return maintaining;
+	}
+	//! Propagates the recorded changes to the materialized views
+	void Apply(ClientContext &context, const maintenance_execute_t &execute);
+
+	//! Calls the callback for every table reference in the query, including the ones in subqueries and CTEs
+	static void EnumerateTableRefs(QueryNode &node, const std::function<void(unique_ptr<TableRef> &ref)> &callback,
+	                               const std::function<void(QueryNode &node)> &node_callback = nullptr);
+
+private:
+	MaterializedViewDelta &GetDelta(ClientContext &context, TableCatalogEntry &table);
+	void AddDeletedRowsInternal(ClientContext &context, TableCatalogEntry &table, Vector &row_ids, idx_t count,
+	                            optional_ptr<const vector<PhysicalIndex>> columns, optional_ptr<DataChunk> updates);
+
+private:
+	mutex lock;
+	//! The changes per table
+	vector<unique_ptr<MaterializedViewDelta>> deltas;
+	bool maintaining = false;
+};
+
+} // namespace duckdb
@@ -21,6 +21,7 @@ class CatalogEntry;
 class ClientContext;
 class PhysicalOperator;
 class SQLStatement;
+struct DataTableInfo;
 
 class PreparedStatementData {
 public:
@@ -45,6 +46,10 @@ public:
 	bound_parameter_map_t value_map;
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
+	//! The key of the statement in the query result cache - empty if the result of the statement cannot be cached
+	string result_cache_key;
+	//! The tables that are read by the statement (if the result can be cached)
+	vector<weak_ptr<DataTableInfo>> result_cache_tables;
 
 public:
 	void CheckParameterCount(idx_t parameter_count);
@@ -30,7 +30,16 @@ enum class MetricsType : uint8_t {
 	OPERATOR_CARDINALITY,
 	CUMULATIVE_ROWS_SCANNED,
 	OPERATOR_ROWS_SCANNED,
-	OPERATOR_TIMING
+	OPERATOR_TIMING,
+	OPERATOR_PEAK_MEMORY,
+	OPERATOR_TEMP_BYTES_WRITTEN,
+	OPERATOR_TEMP_BYTES_READ,
+	OPERATOR_STORAGE_BYTES_READ,
+	OPERATOR_BUFFER_HIT_RATIO,
+	OPERATOR_CPU_CYCLES,
+	OPERATOR_INSTRUCTIONS,
+	OPERATOR_LLC_MISSES,
+	OPERATOR_BRANCH_MISSES
 };
 
 struct MetricsTypeHashFunction {
@@ -48,6 +57,9 @@ public:
 	profiler_settings_t settings;
 	profiler_metrics_t metrics;
 	InsertionOrderPreservingMap<string> extra_info;
+	//! The number of block pins that did (not) have to load the block, used to compute the buffer hit ratio
+	idx_t buffer_hits = 0;
+	idx_t buffer_misses = 0;
 
 public:
 	ProfilingInfo() = default;
@@ -64,12 +76,18 @@ public:
 	const profiler_settings_t &GetSettings();
 	static profiler_settings_t DefaultSettings();
 	static profiler_settings_t DefaultOperatorSettings();
+	//! The metrics that are collected per operator from the thread resource counters, these are not enabled by default
+	static profiler_settings_t ResourceSettings();
+	//! The metrics that are collected per operator from the hardware counters (perf_event on Linux)
+	static profiler_settings_t HardwareSettings();
 
 public:
 	// reset the metrics to default
 	void ResetSettings();
 	void ResetMetrics();
 	bool Enabled(const MetricsType setting) const;
+	//! Add block pins to the buffer hit ratio
+	void AddBufferAccesses(idx_t hits, idx_t misses);
 
 public:
 	string GetMetricAsString(MetricsType setting) const;
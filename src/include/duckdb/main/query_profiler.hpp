@@ -15,6 +15,7 @@
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/profiler.hpp"
 #include "duckdb/common/reference_map.hpp"
+#include "duckdb/common/resource_counters.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/unordered_map.hpp"
@@ -42,6 +43,11 @@ struct OperatorInformation {
 	idx_t elements_returned;
 	string name;
 
+	//! The resources used by the operator, see ResourceCounterSnapshot
+	ResourceCounterSnapshot resources;
+	//! The peak of the net memory reserved by the operator
+	int64_t peak_memory = 0;
+
 	void AddTime(double n_time) {
 		this->time += n_time;
 	}
@@ -49,6 +55,9 @@ struct OperatorInformation {
 	void AddReturnedElements(idx_t n_elements) {
 		this->elements_returned += n_elements;
 	}
+
+	//! Adds the resources used between two snapshots, peak_memory is the peak of the memory reserved in between
+	void AddResources(const ResourceCounterSnapshot &start, const ResourceCounterSnapshot &end, int64_t peak_memory);
 };
 
 //! The OperatorProfiler measures timings of individual operators
@@ -82,6 +91,12 @@ private:
 	//! Sub-settings for the operator profiler
 	profiler_settings_t operator_settings;
 
+	//! Whether or not resource metrics are collected, and whether they include hardware counters
+	bool track_resources = false;
+	bool track_hardware_counters = false;
+	//! The resource counters of this thread when the active operator was started
+	ResourceCounterSnapshot start_resources;
+
 	//! The timer used to time the execution time of the individual Physical Operators
 	Profiler op;
 	//! The stack of Physical Operators that are currently active
@@ -121,6 +136,8 @@ public:
 
 	//! Adds the timings gathered by an OperatorProfiler to this query profiler
 	DUCKDB_API void Flush(OperatorProfiler &profiler);
+	//! Adds information gathered during execution (e.g. by a sink in Finalize) to the extra info of an operator
+	DUCKDB_API void AddOperatorInfo(const PhysicalOperator &op, const string &key, string value);
 
 	DUCKDB_API void StartPhase(string phase);
 	DUCKDB_API void EndPhase();
@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class ColumnDataCollection;
+class DatabaseInstance;
+struct DataTableInfo;
+
+//! A table that is read by a cached query, together with the version of the table the result was computed over
+struct QueryResultCacheDependency {
+	weak_ptr<DataTableInfo> table;
+	transaction_t commit_version;
+};
+
+//! The QueryResultCache holds the results of (read-only, deterministic) queries over DuckDB tables, so that repeated
+//! executions of the same query can scan the cached result instead of running the query again. A result is only valid
+//! as long as none of the tables it depends on has been changed by a committed transaction.
+class QueryResultCache {
+public:
+	explicit QueryResultCache(DatabaseInstance &db);
+	~QueryResultCache();
+
+	static QueryResultCache &Get(ClientContext &context);
+
+	//! Returns the cached result of a query, or nullptr if there is no result computed over the given table versions
+	shared_ptr<ColumnDataCollection> Lookup(const string &key, const vector<QueryResultCacheDependency> &dependencies);
+	//! Copies the result of a query into the cache, evicting the least recently used results if the cache is full
+	void Insert(const string &key, vector<QueryResultCacheDependency> dependencies, ColumnDataCollection &result);
+	//! Removes all cached results
+	void Clear();
+	//! The memory used by the cached results
+	idx_t GetMemoryUsage();
+
+private:
+	struct CachedResult {
+		shared_ptr<ColumnDataCollection> collection;
+		vector<QueryResultCacheDependency> dependencies;
+		idx_t size;
+		//! The position of the entry in the LRU list
+		list<string>::iterator lru_position;
+	};
+
+	void EraseEntry(unordered_map<string, CachedResult>::iterator entry);
+	//! Evicts the least recently used results until the memory usage is below the limit
+	void EvictEntries(idx_t memory_limit);
+
+private:
+	DatabaseInstance &db;
+	mutex lock;
+	unordered_map<string, CachedResult> entries;
+	//! The keys of the entries, from most to least recently used
+	list<string> lru;
+	idx_t memory_usage = 0;
+};
+
+} // namespace duckdb
@@ -91,6 +91,46 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct WALCommitDelaySetting {
+	static constexpr const char *Name = "wal_commit_delay";
+	static constexpr const char *Description =
+	    "The time (in microseconds) a commit waits before syncing the WAL, so that concurrent commits are synced together";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALAsyncCommitSetting {
+	static constexpr const char *Name = "wal_async_commit";
+	static constexpr const char *Description = "Whether or not commits return before their changes are synced to disk. "
+	                                           "The WAL is synced at most once per wal_commit_delay by later commits";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct CompactionThresholdSetting {
+	static constexpr const char *Name = "compaction_threshold";
+	static constexpr const char *Description =
+	    "The fraction of deleted rows at which a checkpoint rewrites a row group to remove the deleted rows";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct CompactionRowLimitSetting {
+	static constexpr const char *Name = "compaction_row_limit";
+	static constexpr const char *Description =
+	    "The maximum number of rows a checkpoint rewrites per table to remove deleted rows (0 means no limit)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugCheckpointAbort {
 	static constexpr const char *Name = "debug_checkpoint_abort";
 	static constexpr const char *Description =
@@ -348,6 +388,25 @@ struct EnableObjectCacheSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableQueryResultCacheSetting {
+	static constexpr const char *Name = "enable_query_result_cache";
+	static constexpr const char *Description =
+	    "Whether or not the results of repeated read-only queries over DuckDB tables are cached";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryResultCacheLimitSetting {
+	static constexpr const char *Name = "query_result_cache_limit";
+	static constexpr const char *Description = "The maximum amount of memory used by the query result cache";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct StorageCompatibilityVersion {
 	static constexpr const char *Name = "storage_compatibility_version";
 	static constexpr const char *Description = "Serialize on checkpoint with compatibility for a given duckdb version";
@@ -385,6 +444,16 @@ struct CustomProfilingSettings {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableCompiledExpressionsSetting {
+	static constexpr const char *Name = "enable_compiled_expressions";
+	static constexpr const char *Description =
+	    "Whether or not to compile scalar expressions over fixed-width types into fused loops";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableProgressBarSetting {
 	static constexpr const char *Name = "enable_progress_bar";
 	static constexpr const char *Description =
@@ -791,6 +860,16 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "Whether or not to compress the blocks that are spilled to the temporary files (when they compress well)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
@@ -800,6 +879,16 @@ struct ThreadsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct AsyncIOThreadsSetting {
+	static constexpr const char *Name = "async_io_threads";
+	static constexpr const char *Description =
+	    "The number of threads that perform I/O for scans that yield instead of blocking on I/O (0 to disable)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct UsernameSetting {
 	static constexpr const char *Name = "username";
 	static constexpr const char *Description = "The username to use. Ignored for legacy compatibility.";
@@ -0,0 +1,43 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/late_materialization.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+
+namespace duckdb {
+class Expression;
+class LogicalOperator;
+class Optimizer;
+
+//! LateMaterialization rewrites a Top-N over a table scan so that the Top-N only carries the sort keys and the row
+//! ids. The remaining columns are fetched for the (few) winning rows afterwards.
+class LateMaterialization {
+public:
+	explicit LateMaterialization(Optimizer &optimizer);
+
+	//! The maximum amount of rows (limit + offset) for which we perform late materialization
+	static constexpr idx_t MAX_ROW_COUNT = 1024;
+
+public:
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	void OptimizeInternal(unique_ptr<LogicalOperator> &op);
+	bool TryLateMaterialization(unique_ptr<LogicalOperator> &op);
+	//! Whether or not the expression only references columns of the given table and is not volatile
+	static bool CanPushExpression(Expression &expr, idx_t table_index);
+
+private:
+	Optimizer &optimizer;
+	//! The bindings of the late materialized columns that have to be updated in the rest of the plan
+	vector<ReplacementBinding> replacement_bindings;
+};
+
+} // namespace duckdb
@@ -51,6 +51,8 @@ public:
 
 	//! Perform the callback to indicate the Interrupt is over
 	DUCKDB_API void Callback() const;
+	//! Whether or not the caller can block, i.e. whether a Callback can be made to resume it
+	DUCKDB_API bool CanBlock() const;
 
 protected:
 	//! Current interrupt mode
@@ -12,8 +12,11 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/vector.hpp"
+#include "duckdb/parallel/interrupt.hpp"
 #include "duckdb/parallel/task.hpp"
 
+#include <functional>
+
 namespace duckdb {
 
 struct ConcurrentQueue;
@@ -23,6 +26,7 @@ class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
+struct AsyncIOQueue;
 
 struct ProducerToken {
 	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
@@ -48,6 +52,8 @@ public:
 	unique_ptr<ProducerToken> CreateProducer();
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
+	//! Schedule a set of tasks to be executed by the task scheduler - the tasks are moved out of the vector
+	void ScheduleTasks(ProducerToken &producer, vector<shared_ptr<Task>> &tasks);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
 	bool GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined
@@ -65,6 +71,12 @@ public:
 
 	void RelaunchThreads();
 
+	//! Schedule a blocking I/O operation on the I/O threads. The callback of the interrupt state is made once the
+	//! operation has completed. Returns false if there are no I/O threads, in which case the caller performs the I/O.
+	bool ScheduleIO(std::function<void()> io, const InterruptState &interrupt_state);
+	//! Sets the amount of threads used for asynchronous I/O, waits for the outstanding I/O if the threads are stopped
+	void SetIOThreads(idx_t io_threads);
+
 	//! Returns the number of threads
 	DUCKDB_API int32_t NumberOfThreads();
 
@@ -105,6 +117,8 @@ private:
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
 	atomic<int32_t> current_thread_count;
+	//! The queue and threads for asynchronous I/O
+	unique_ptr<AsyncIOQueue> io_queue;
 };
 
 } // namespace duckdb
@@ -32,6 +32,8 @@ struct CreateTableInfo : public CreateInfo {
 	vector<unique_ptr<Constraint>> constraints;
 	//! CREATE TABLE as QUERY
 	unique_ptr<SelectStatement> query;
+	//! The defining query of a materialized view (if any), the table holds the (maintained) result of the query
+	unique_ptr<SelectStatement> materialized_view_query;
 
 public:
 	DUCKDB_API unique_ptr<CreateInfo> Copy() const override;
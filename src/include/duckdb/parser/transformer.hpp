@@ -32,6 +32,7 @@ namespace duckdb {
 class ColumnDefinition;
 struct OrderByNode;
 struct CopyInfo;
+struct CreateViewInfo;
 struct CommonTableExpressionInfo;
 struct GroupingExpressionMap;
 class OnConflictInfo;
@@ -129,6 +130,8 @@ private:
 	unique_ptr<CreateStatement> TransformCreateSequence(duckdb_libpgquery::PGCreateSeqStmt &node);
 	//! Transform a Postgres duckdb_libpgquery::T_PGViewStmt node into a CreateStatement
 	unique_ptr<CreateStatement> TransformCreateView(duckdb_libpgquery::PGViewStmt &node);
+	//! Turn a CREATE VIEW ... WITH (materialized) statement into the creation of a materialized view
+	unique_ptr<CreateInfo> TransformMaterializedView(CreateViewInfo &view_info);
 	//! Transform a Postgres duckdb_libpgquery::T_PGIndexStmt node into CreateStatement
 	unique_ptr<CreateStatement> TransformCreateIndex(duckdb_libpgquery::PGIndexStmt &stmt);
 	//! Transform a Postgres duckdb_libpgquery::T_PGCreateFunctionStmt node into CreateStatement
@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_table_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+struct UnifiedVectorFormat;
+
+//! The BloomTableFilter is a runtime filter generated from the build side of a hash join.
+//! It only removes rows that are guaranteed to not find a join partner, i.e. it can produce false positives, so the
+//! join itself must still be evaluated.
+class BloomTableFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+	//! The amount of rows that are probed before we check whether or not the filter is worth evaluating
+	static constexpr const idx_t ADAPTIVE_PROBE_COUNT = 64 * STANDARD_VECTOR_SIZE;
+	//! The filter is disabled if (after ADAPTIVE_PROBE_COUNT rows) more than this fraction of rows pass it
+	static constexpr const double ADAPTIVE_PASS_THRESHOLD = 0.95;
+
+public:
+	explicit BloomTableFilter(shared_ptr<BloomFilter> filter);
+
+	//! The (immutable) Bloom filter containing the hashes of the build-side keys
+	shared_ptr<BloomFilter> filter;
+
+public:
+	//! Filters the rows of the vector referenced by "sel", keeping only the (non-NULL) rows whose hash might be present
+	//! in the Bloom filter. "count" is the size of the vector.
+	idx_t Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count,
+	             idx_t count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+
+private:
+	//! The amount of rows probed and the amount of rows that passed - used to disable non-selective filters
+	mutable atomic<idx_t> probed_count;
+	mutable atomic<idx_t> passed_count;
+	mutable atomic<bool> disabled;
+};
+
+} // namespace duckdb
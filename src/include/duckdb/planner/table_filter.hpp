@@ -28,7 +28,9 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6, // runtime Bloom filter generated from the build side of a hash join
+	IN_FILTER = 7     // col IN (C1, C2, ...)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
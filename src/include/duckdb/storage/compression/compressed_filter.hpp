@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/compressed_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/type_util.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+namespace duckdb {
+
+//! CompressedFilter evaluates a table filter that consists of (a conjunction of) constant comparisons on individual
+//! values of physical type T. Compression methods use it to evaluate a filter once per run, dictionary entry or
+//! constant group instead of once per row.
+template <class T>
+struct CompressedFilter {
+public:
+	//! The comparisons that all have to hold
+	vector<pair<ExpressionType, T>> comparisons;
+
+public:
+	//! Initializes the filter - returns false if the filter cannot be evaluated on compressed data
+	bool Initialize(const TableFilter &filter) {
+		comparisons.clear();
+		return AddFilter(filter);
+	}
+
+	bool Matches(const T &value) const {
+		for (auto &comparison : comparisons) {
+			if (!Compare(comparison.first, value, comparison.second)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static bool Compare(ExpressionType comparison_type, const T &value, const T &constant) {
+		switch (comparison_type) {
+		case ExpressionType::COMPARE_EQUAL:
+			return Equals::Operation(value, constant);
+		case ExpressionType::COMPARE_NOTEQUAL:
+			return NotEquals::Operation(value, constant);
+		case ExpressionType::COMPARE_LESSTHAN:
+			return LessThan::Operation(value, constant);
+		case ExpressionType::COMPARE_GREATERTHAN:
+			return GreaterThan::Operation(value, constant);
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			return LessThanEquals::Operation(value, constant);
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			return GreaterThanEquals::Operation(value, constant);
+		default:
+			throw InternalException("Unsupported comparison type for CompressedFilter");
+		}
+	}
+
+private:
+	bool AddFilter(const TableFilter &filter) {
+		switch (filter.filter_type) {
+		case TableFilterType::CONSTANT_COMPARISON: {
+			auto &constant_filter = filter.Cast<ConstantFilter>();
+			switch (constant_filter.comparison_type) {
+			case ExpressionType::COMPARE_EQUAL:
+			case ExpressionType::COMPARE_NOTEQUAL:
+			case ExpressionType::COMPARE_LESSTHAN:
+			case ExpressionType::COMPARE_GREATERTHAN:
+			case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+				break;
+			default:
+				return false;
+			}
+			if (constant_filter.constant.IsNull() || constant_filter.constant.type().InternalType() != GetTypeId<T>()) {
+				return false;
+			}
+			comparisons.emplace_back(constant_filter.comparison_type, constant_filter.constant.GetValueUnsafe<T>());
+			return true;
+		}
+		case TableFilterType::CONJUNCTION_AND: {
+			auto &conjunction_and = filter.Cast<ConjunctionAndFilter>();
+			for (auto &child_filter : conjunction_and.child_filters) {
+				if (!AddFilter(*child_filter)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+};
+
+} // namespace duckdb
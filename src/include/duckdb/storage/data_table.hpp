@@ -110,8 +110,13 @@ public:
 	//! Append a column data collection to the transaction-local storage of this table
 	void LocalAppend(TableCatalogEntry &table, ClientContext &context, ColumnDataCollection &collection,
 	                 const vector<unique_ptr<BoundConstraint>> &bound_constraints);
+	//! Copies the columns required by the transaction-local indexes from a collection that is about to be merged
+	unique_ptr<LocalIndexAppend> InitializeLocalIndexAppend(ClientContext &context, RowGroupCollection &collection);
 	//! Merge a row group collection into the transaction-local storage
-	void LocalMerge(ClientContext &context, RowGroupCollection &collection);
+	void LocalMerge(ClientContext &context, RowGroupCollection &collection,
+	                optional_ptr<LocalIndexAppend> index_append = nullptr);
+	//! Appends the rows of merged collections to the transaction-local indexes
+	void FinalizeLocalIndexAppends(ClientContext &context, vector<unique_ptr<LocalIndexAppend>> &index_appends);
 	//! Creates an optimistic writer for this table - used for optimistically writing parallel appends
 	OptimisticDataWriter &CreateOptimisticWriter(ClientContext &context);
 	void FinalizeOptimisticWriter(ClientContext &context, OptimisticDataWriter &writer);
@@ -196,6 +201,8 @@ public:
 	idx_t GetTotalRows() const;
 
 	vector<ColumnSegmentInfo> GetColumnSegmentInfo();
+	//! Returns information about the deleted rows in the table, and about their compaction
+	RowGroupCompactionInfo GetCompactionInfo();
 	static bool IsForeignKeyIndex(const vector<PhysicalIndex> &fk_keys, Index &index, ForeignKeyType fk_type);
 
 	//! Scans the next chunk for the CREATE INDEX operator
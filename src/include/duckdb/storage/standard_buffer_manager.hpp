@@ -147,8 +147,12 @@ protected:
 	//! overwrites the data within with garbage. Any readers that do not hold the pin will notice
 	void VerifyZeroReaders(shared_ptr<BlockHandle> &handle);
 
+	//! Reads the runs of adjacent blocks (first and last block id) in a single batch
 	void BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
-	               block_id_t first_block, block_id_t last_block);
+	               const vector<pair<block_id_t, block_id_t>> &runs);
+	//! Loads the blocks of a run from the buffer that they were read into
+	void LoadBlocksFromBuffer(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+	                          BufferHandle &intermediate_buffer, block_id_t first_block, idx_t block_count);
 
 protected:
 	// These are stored here because temp_directory creation is lazy
@@ -20,6 +20,7 @@
 #include "duckdb/common/serializer/serialization_traits.hpp"
 
 namespace duckdb {
+class BloomFilter;
 class ColumnData;
 class ColumnSegment;
 class DatabaseInstance;
@@ -162,6 +163,9 @@ public:
 	virtual void Verify(RowGroup &parent);
 
 	FilterPropagateResult CheckZonemap(TableFilter &filter);
+	//! Returns the Bloom filter over the persisted values of this column (if any)
+	shared_ptr<BloomFilter> GetBloomFilter() const;
+	void SetBloomFilter(shared_ptr<BloomFilter> new_filter);
 
 	static shared_ptr<ColumnData> CreateColumn(BlockManager &block_manager, DataTableInfo &info, idx_t column_index,
 	                                           idx_t start_row, const LogicalType &type,
@@ -185,6 +189,10 @@ protected:
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 	idx_t ScanVector(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
 	                 idx_t target_scan);
+	//! Evaluates a filter on the compressed data of an entire base vector, without merging in updates
+	//! Returns false (without scanning anything) if the filter cannot be evaluated on the compressed data
+	bool FilterVector(ColumnScanState &state, Vector &result, idx_t target_scan, SelectionVector &sel, idx_t &sel_count,
+	                  const TableFilter &filter);
 
 	void ClearUpdates();
 	void FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result, idx_t scan_count,
@@ -206,6 +214,9 @@ protected:
 	mutable mutex stats_lock;
 	//! The stats of the root segment
 	unique_ptr<SegmentStatistics> stats;
+	//! A Bloom filter over the values written at the last checkpoint - only set while the column is unmodified since
+	//! (protected by the stats lock)
+	shared_ptr<BloomFilter> bloom_filter;
 	//! Total transient allocation size
 	idx_t allocation_size;
 };
@@ -224,6 +235,8 @@ struct PersistentColumnData {
 	PhysicalType physical_type;
 	vector<DataPointer> pointers;
 	vector<PersistentColumnData> child_columns;
+	//! An (optional) Bloom filter over the values of the column
+	shared_ptr<BloomFilter> bloom_filter;
 
 	void Serialize(Serializer &serializer) const;
 	static PersistentColumnData Deserialize(Deserializer &deserializer);
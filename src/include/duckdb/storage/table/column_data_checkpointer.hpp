@@ -16,6 +16,14 @@ namespace duckdb {
 struct TableScanOptions;
 
 class ColumnDataCheckpointer {
+public:
+	//! The amount of bits per value that are initially allocated for a Bloom filter, before it is shrunk
+	static constexpr const idx_t BLOOM_FILTER_BITS_PER_KEY = 16;
+	//! The maximum size of a Bloom filter in blocks
+	static constexpr const idx_t BLOOM_FILTER_MAX_BLOCKS = 65536;
+	//! The maximum false positive rate of a persisted Bloom filter
+	static constexpr const double BLOOM_FILTER_MAX_FALSE_POSITIVE_RATE = 0.05;
+
 public:
 	ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup &row_group_p, ColumnCheckpointState &state_p,
 	                       ColumnCheckpointInfo &checkpoint_info);
@@ -36,6 +44,8 @@ private:
 	void WriteToDisk();
 	bool HasChanges();
 	void WritePersistentSegments();
+	//! Whether or not a Bloom filter over the values should be written together with the column
+	bool ShouldCreateBloomFilter();
 
 private:
 	ColumnData &col_data;
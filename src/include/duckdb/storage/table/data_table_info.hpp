@@ -49,6 +49,27 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! Returns the id of the last transaction that committed changes to the table
+	transaction_t GetCommitVersion() const {
+		return commit_version;
+	}
+	//! Registers that the transaction with the given commit id committed changes to the table
+	void SetCommitVersion(transaction_t commit_id) {
+		commit_version = commit_id;
+	}
+
+	//! Registers that a checkpoint compacted the given number of row groups by rewriting the given number of rows
+	void AddCompaction(idx_t row_groups, idx_t rows) {
+		compacted_row_groups += row_groups;
+		compacted_rows += rows;
+	}
+	idx_t GetCompactedRowGroups() const {
+		return compacted_row_groups;
+	}
+	idx_t GetCompactedRows() const {
+		return compacted_rows;
+	}
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -66,6 +87,11 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! The commit id of the last transaction that changed the table (0 if it was not changed since it was loaded)
+	atomic<transaction_t> commit_version {0};
+	//! The number of row groups and rows that were compacted by checkpoints
+	atomic<idx_t> compacted_row_groups {0};
+	atomic<idx_t> compacted_rows {0};
 };
 
 } // namespace duckdb
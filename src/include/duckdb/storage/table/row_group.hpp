@@ -27,6 +27,7 @@ class DatabaseInstance;
 class DataTable;
 class PartialBlockManager;
 struct DataTableInfo;
+struct PrefetchState;
 class ExpressionExecutor;
 class RowGroupCollection;
 class RowGroupWriter;
@@ -107,6 +108,8 @@ public:
 	//! Initialize a scan over this row_group
 	bool InitializeScan(CollectionScanState &state);
 	bool InitializeScanWithOffset(CollectionScanState &state, idx_t vector_offset);
+	//! Collects the blocks that are required to scan the next max_count rows of the scan
+	void InitializePrefetch(CollectionScanState &state, PrefetchState &prefetch_state, idx_t max_count);
 	//! Checks the given set of table filters against the row-group statistics. Returns false if the entire row group
 	//! can be skipped.
 	bool CheckZonemap(ScanFilterInfo &filters);
@@ -29,6 +29,7 @@ class BoundConstraint;
 class RowGroupSegmentTree;
 class StorageCommitState;
 struct ColumnSegmentInfo;
+struct RowGroupCompactionInfo;
 class MetadataManager;
 struct VacuumState;
 struct CollectionCheckpointState;
@@ -105,6 +106,7 @@ public:
 	void CommitDropTable();
 
 	vector<ColumnSegmentInfo> GetColumnSegmentInfo();
+	RowGroupCompactionInfo GetCompactionInfo();
 	const vector<LogicalType> &GetTypes() const;
 
 	shared_ptr<RowGroupCollection> AddColumn(ClientContext &context, ColumnDefinition &new_column,
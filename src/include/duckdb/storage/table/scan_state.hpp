@@ -35,6 +35,7 @@ class DuckTransaction;
 class RowGroupSegmentTree;
 class TableFilter;
 struct AdaptiveFilterState;
+struct PrefetchState;
 struct TableScanOptions;
 
 struct SegmentScanState {
@@ -196,6 +197,8 @@ public:
 	bool Scan(DuckTransaction &transaction, DataChunk &result);
 	bool ScanCommitted(DataChunk &result, TableScanType type);
 	bool ScanCommitted(DataChunk &result, SegmentLock &l, TableScanType type);
+	//! Collects the blocks that are required to scan the next vector of the current row group
+	void InitializePrefetch(PrefetchState &prefetch_state);
 
 private:
 	TableScanState &parent;
@@ -35,6 +35,24 @@ struct ColumnSegmentInfo {
 	string segment_info;
 };
 
+//! Compaction information of the row groups of a table
+struct RowGroupCompactionInfo {
+	//! The number of row groups
+	idx_t row_group_count = 0;
+	//! The number of rows stored in the row groups, including deleted rows
+	idx_t total_rows = 0;
+	//! The number of committed deleted rows that are still stored in the row groups
+	idx_t deleted_rows = 0;
+	//! The number of row groups that will be compacted by a checkpoint
+	idx_t pending_row_groups = 0;
+	//! Whether or not deleted rows can be compacted (tables with indexes are not compacted)
+	bool can_compact = false;
+	//! The number of row groups that were compacted by checkpoints since the database was opened
+	idx_t compacted_row_groups = 0;
+	//! The number of rows that were rewritten by compaction since the database was opened
+	idx_t compacted_rows = 0;
+};
+
 //! Table storage information
 class TableStorageInfo {
 public:
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/block_manager.hpp"
@@ -27,7 +28,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -48,6 +49,8 @@ private:
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
+	//! The size of the blocks on disk, used to keep track of the size of the temporary files
+	idx_t block_size;
 };
 
 //===--------------------------------------------------------------------===//
@@ -70,12 +73,14 @@ public:
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+//! A temporary file stores blocks in slots of a fixed size. Files with slots smaller than the block allocation size
+//! store compressed blocks, prefixed by their compressed size.
 class TemporaryFileHandle {
 	constexpr static idx_t MAX_ALLOWED_INDEX_BASE = 4000;
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    idx_t slot_size, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -88,11 +93,16 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes a block, compressed_buffer holds the compressed block if this file stores compressed blocks
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
+	idx_t GetSlotSize() const {
+		return slot_size;
+	}
+	bool IsCompressed() const;
 
 private:
 	void CreateFileIfNotExists(TemporaryFileLock &);
@@ -104,11 +114,37 @@ private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	idx_t slot_size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
 };
 
+//===--------------------------------------------------------------------===//
+// TemporaryFileCompressionAdaptivity
+//===--------------------------------------------------------------------===//
+
+enum class TemporaryCompressionCodec : uint8_t { UNCOMPRESSED = 0, LZ4 = 1, LZ4_FAST = 2 };
+
+//! TemporaryFileCompressionAdaptivity picks the codec of the next block that is spilled, based on how well the
+//! previous blocks compressed. When a block does not compress into a smaller size class, compression is skipped for an
+//! (exponentially) increasing number of blocks, so that incompressible data is not slowed down.
+class TemporaryFileCompressionAdaptivity {
+	static constexpr idx_t MAX_SKIPPED_BLOCKS = 64;
+
+public:
+	TemporaryCompressionCodec GetCodec();
+	void Update(TemporaryCompressionCodec codec, idx_t uncompressed_size, idx_t slot_size);
+
+private:
+	//! The number of blocks that are written uncompressed before compression is attempted again
+	atomic<idx_t> skipped_blocks {0};
+	//! The number of blocks that are skipped after the next block that does not compress
+	atomic<idx_t> backoff {1};
+	//! Whether or not the previous block compressed to less than half of its size
+	atomic<bool> compresses_well {true};
+};
+
 //===--------------------------------------------------------------------===//
 // TemporaryDirectoryHandle
 //===--------------------------------------------------------------------===//
@@ -145,7 +181,7 @@ public:
 		lock_guard<mutex> lock;
 	};
 
-	void WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer);
+	void WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer);
 	bool HasTemporaryBuffer(block_id_t block_id);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(block_id_t id, unique_ptr<FileBuffer> reusable_buffer);
 	void DeleteTemporaryBuffer(block_id_t id);
@@ -164,6 +200,8 @@ private:
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
 	TemporaryFileIndex GetTempBlockIndex(TemporaryManagerLock &, block_id_t id);
 	void EraseFileHandle(TemporaryManagerLock &, idx_t file_index);
+	//! Compresses the buffer (if enabled and worthwhile), returns the slot size that the block is written to
+	idx_t CompressBuffer(MemoryTag tag, FileBuffer &buffer, AllocatedData &compressed_buffer);
 
 private:
 	DatabaseInstance &db;
@@ -180,6 +218,8 @@ private:
 	atomic<idx_t> size_on_disk;
 	//! The max amount of disk space that can be used
 	idx_t max_swap_space;
+	//! The compression codec selection, per memory tag, as e.g. sorted data compresses differently than hash tables
+	TemporaryFileCompressionAdaptivity compression_adaptivity[MEMORY_TAG_COUNT];
 };
 
 } // namespace duckdb
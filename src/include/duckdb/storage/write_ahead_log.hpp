@@ -12,6 +12,7 @@
 #include "duckdb/catalog/catalog_entry/scalar_macro_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/sequence_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
@@ -20,6 +21,8 @@
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -113,6 +116,13 @@ public:
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
 	void Flush();
+	//! Write a flush marker and write the buffered entries to the WAL file, without syncing the file to disk
+	//! Returns the size up to which the WAL file has to be synced for the written entries to be durable
+	idx_t WriteFlush();
+	//! Sync the WAL file to disk up to (at least) the given size. Concurrent committers are grouped: a single committer
+	//! syncs the file on behalf of all waiting committers, after waiting "commit_delay" microseconds for more commits.
+	//! In asynchronous mode committers do not wait, and the file is synced at most once every commit delay
+	void SyncUpTo(idx_t size, idx_t commit_delay, bool async);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -123,6 +133,18 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+	//! Lock protecting the group commit state
+	mutex sync_lock;
+	//! Signalled whenever a sync of the WAL file has finished
+	std::condition_variable sync_finished;
+	//! Whether or not a committer is currently syncing the WAL file
+	bool sync_in_progress = false;
+	//! The size of the WAL file that committed transactions require to be synced
+	idx_t requested_size = 0;
+	//! The size of the WAL file that is known to be synced to disk
+	idx_t synced_size = 0;
+	//! The time at which the last sync finished
+	steady_clock::time_point last_sync;
 };
 
 } // namespace duckdb
@@ -13,6 +13,7 @@
 #include "duckdb/storage/table/table_statistics.hpp"
 #include "duckdb/storage/optimistic_data_writer.hpp"
 #include "duckdb/common/reference_map.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 
 namespace duckdb {
 class AttachedDatabase;
@@ -22,6 +23,18 @@ class StorageCommitState;
 class Transaction;
 class WriteAheadLog;
 struct LocalAppendState;
+
+//! The rows of a collection that is merged into the transaction-local storage, that still have to be appended to the
+//! transaction-local indexes. The index entries are constructed after the merge, outside of any lock held during the
+//! merge (see LocalStorage::InitializeIndexAppend)
+struct LocalIndexAppend {
+	//! The columns required by the indexes
+	vector<column_t> column_ids;
+	//! The required columns of the merged rows
+	unique_ptr<ColumnDataCollection> data;
+	//! The row id of the first merged row
+	row_t row_start = 0;
+};
 struct TableAppendState;
 
 class LocalTableStorage : public enable_shared_from_this<LocalTableStorage> {
@@ -91,6 +104,8 @@ private:
 
 //! The LocalStorage class holds appends that have not been committed yet
 class LocalStorage {
+	friend class LocalIndexAppendTask;
+
 public:
 	// Threshold to merge row groups instead of appending
 	static constexpr const idx_t MERGE_THRESHOLD = Storage::ROW_GROUP_SIZE;
@@ -125,8 +140,17 @@ public:
 	static void Append(LocalAppendState &state, DataChunk &chunk);
 	//! Finish appending to the local storage
 	static void FinalizeAppend(LocalAppendState &state);
-	//! Merge a row group collection into the transaction-local storage
-	void LocalMerge(DataTable &table, RowGroupCollection &collection);
+	//! Copies the columns required by the transaction-local indexes from a collection that is about to be merged.
+	//! Returns nullptr if the table has no transaction-local indexes
+	unique_ptr<LocalIndexAppend> InitializeIndexAppend(DataTable &table, RowGroupCollection &collection);
+	//! Merge a row group collection into the transaction-local storage. If index_append is set, the rows are not
+	//! appended to the indexes - this has to be done with FinalizeIndexAppends
+	void LocalMerge(DataTable &table, RowGroupCollection &collection,
+	                optional_ptr<LocalIndexAppend> index_append = nullptr);
+	//! Appends merged rows to the transaction-local indexes. The index entries of every append are constructed in
+	//! a separate index, which is then merged into the transaction-local index. Different appends are processed in
+	//! parallel, and this can be called concurrently for the same table
+	void FinalizeIndexAppends(DataTable &table, vector<unique_ptr<LocalIndexAppend>> &index_appends);
 	//! Create an optimistic writer for the specified table
 	OptimisticDataWriter &CreateOptimisticWriter(DataTable &table);
 	void FinalizeOptimisticWriter(DataTable &table, OptimisticDataWriter &writer);
@@ -168,6 +192,7 @@ private:
 	LocalTableManager table_manager;
 
 	void Flush(DataTable &table, LocalTableStorage &storage, optional_ptr<StorageCommitState> commit_state);
+	void FinalizeIndexAppend(DataTable &table, LocalIndexAppend &index_append);
 };
 
 } // namespace duckdb
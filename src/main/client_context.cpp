@@ -1,15 +1,19 @@
 #include "duckdb/main/client_context.hpp"
 
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/catalog/catalog_entry/scalar_function_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_search_path.hpp"
 #include "duckdb/common/error_data.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/progress_bar/progress_bar.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/execution/column_binding_resolver.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/main/appender.hpp"
 #include "duckdb/main/attached_database.hpp"
@@ -20,7 +24,9 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/materialized_view_maintenance.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
 #include "duckdb/main/stream_query_result.hpp"
@@ -36,10 +42,17 @@
 #include "duckdb/parser/statement/prepare_statement.hpp"
 #include "duckdb/parser/statement/relation_statement.hpp"
 #include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
 #include "duckdb/planner/operator/logical_execute.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/planner.hpp"
 #include "duckdb/planner/pragma_handler.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/transaction/transaction_manager.hpp"
 
@@ -55,6 +68,12 @@ public:
 	unique_ptr<Executor> executor;
 	//! The progress bar
 	unique_ptr<ProgressBar> progress_bar;
+	//! The key of the query in the query result cache - set if the result should be inserted into the cache
+	string result_cache_key;
+	//! The versions of the tables that the result of the query is computed over
+	vector<QueryResultCacheDependency> result_cache_dependencies;
+	//! The cached result that is scanned by the query (on a cache hit)
+	shared_ptr<ColumnDataCollection> cached_result;
 
 public:
 	void SetOpenResult(BaseQueryResult &result) {
@@ -213,6 +232,23 @@ ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success,
 	D_ASSERT(active_query.get());
 	active_query.reset();
 	query_progress.Initialize();
+	ErrorData maintenance_error;
+	auto &maintenance = MaterializedViewMaintenance::Get(*this);
+	if (!maintenance.IsMaintaining()) {
+		if (success && maintenance.HasChanges()) {
+			// the views are brought up to date as part of the statement - before the transaction is committed
+			try {
+				MaintainMaterializedViews(lock);
+			} catch (std::exception &ex) {
+				maintenance_error = ErrorData(ex);
+				success = false;
+				invalidate_transaction = true;
+				previous_error = &maintenance_error;
+			}
+		} else {
+			maintenance.Clear();
+		}
+	}
 	ErrorData error;
 	try {
 		if (transaction.HasActiveTransaction()) {
@@ -237,6 +273,10 @@ ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success,
 	} catch (...) { // LCOV_EXCL_START
 		error = ErrorData("Unhandled exception!");
 	} // LCOV_EXCL_STOP
+	if (!error.HasError() && maintenance_error.HasError()) {
+		error = std::move(maintenance_error);
+		previous_error = nullptr;
+	}
 
 	// Notify any registered state of query end
 	for (auto const &s : registered_state->States()) {
@@ -250,6 +290,34 @@ ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success,
 	return error;
 }
 
+void ClientContext::MaintainMaterializedViews(ClientContextLock &lock) {
+	// the maintenance statements run as part of the current transaction, without being profiled
+	auto auto_commit = transaction.IsAutoCommit();
+	auto &client_config = ClientConfig::GetConfig(*this);
+	auto enable_profiler = client_config.enable_profiler;
+	transaction.SetAutoCommit(false);
+	client_config.enable_profiler = false;
+	try {
+		MaterializedViewMaintenance::Get(*this).Apply(*this, [&](unique_ptr<SQLStatement> statement) {
+			auto pending = PendingQueryInternal(lock, std::move(statement), PendingQueryParameters(), false);
+			if (pending->HasError()) {
+				pending->ThrowError();
+			}
+			auto result = ExecutePendingQueryInternal(lock, *pending);
+			if (result->HasError()) {
+				result->ThrowError();
+			}
+			return unique_ptr_cast<QueryResult, MaterializedQueryResult>(std::move(result));
+		});
+	} catch (...) {
+		transaction.SetAutoCommit(auto_commit);
+		client_config.enable_profiler = enable_profiler;
+		throw;
+	}
+	transaction.SetAutoCommit(auto_commit);
+	client_config.enable_profiler = enable_profiler;
+}
+
 void ClientContext::CleanupInternal(ClientContextLock &lock, BaseQueryResult *result, bool invalidate_transaction) {
 	if (!active_query) {
 		// no query currently active
@@ -298,6 +366,13 @@ unique_ptr<QueryResult> ClientContext::FetchResultInternal(ClientContextLock &lo
 	D_ASSERT(executor.HasResultCollector());
 	// we have a result collector - fetch the result directly from the result collector
 	result = executor.GetResult();
+	if (!create_stream_result && !active_query->result_cache_key.empty() &&
+	    result->type == QueryResultType::MATERIALIZED_RESULT && !result->HasError()) {
+		auto &materialized = result->Cast<MaterializedQueryResult>();
+		QueryResultCache::Get(*this).Insert(active_query->result_cache_key,
+		                                    std::move(active_query->result_cache_dependencies),
+		                                    materialized.Collection());
+	}
 	if (!create_stream_result) {
 		CleanupInternal(lock, result.get(), false);
 	} else {
@@ -317,6 +392,83 @@ static bool IsExplainAnalyze(SQLStatement *statement) {
 	return explain.explain_type == ExplainType::EXPLAIN_ANALYZE;
 }
 
+static bool IsCacheableExpression(const Expression &expr) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_FUNCTION:
+		if (expr.Cast<BoundFunctionExpression>().function.stability != FunctionStability::CONSISTENT) {
+			return false;
+		}
+		break;
+	case ExpressionClass::BOUND_AGGREGATE:
+		if (expr.Cast<BoundAggregateExpression>().function.stability != FunctionStability::CONSISTENT) {
+			return false;
+		}
+		break;
+	default:
+		break;
+	}
+	bool cacheable = true;
+	ExpressionIterator::EnumerateChildren(expr, [&](const Expression &child) {
+		if (!IsCacheableExpression(child)) {
+			cacheable = false;
+		}
+	});
+	return cacheable;
+}
+
+//! Collects the tables that are read by the plan, returns false if the result of the plan cannot be cached
+static bool GetResultCacheTables(LogicalOperator &op, vector<weak_ptr<DataTableInfo>> &tables) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_GET: {
+		// we can only detect changes to the data of DuckDB tables
+		auto table = op.Cast<LogicalGet>().GetTable();
+		if (!table || !table->IsDuckTable()) {
+			return false;
+		}
+		tables.push_back(table->GetStorage().GetDataTableInfo());
+		break;
+	}
+	case LogicalOperatorType::LOGICAL_SAMPLE:
+		return false;
+	default:
+		break;
+	}
+	bool cacheable = true;
+	LogicalOperatorVisitor::EnumerateExpressions(op, [&](unique_ptr<Expression> *expr) {
+		if (!IsCacheableExpression(**expr)) {
+			cacheable = false;
+		}
+	});
+	for (auto &child : op.children) {
+		if (!cacheable) {
+			break;
+		}
+		cacheable = GetResultCacheTables(*child, tables);
+	}
+	return cacheable;
+}
+
+//! Computes the key of the result of a (bound) plan in the query result cache
+static void SetResultCacheKey(PreparedStatementData &statement, LogicalOperator &plan) {
+	if (statement.statement_type != StatementType::SELECT_STATEMENT ||
+	    !statement.properties.modified_databases.empty()) {
+		return;
+	}
+	vector<weak_ptr<DataTableInfo>> tables;
+	if (!GetResultCacheTables(plan, tables) || tables.empty()) {
+		return;
+	}
+	MemoryStream stream;
+	try {
+		BinarySerializer::Serialize(plan, stream);
+	} catch (std::exception &) {
+		// not all plans can be serialized - we cannot cache their results
+		return;
+	}
+	statement.result_cache_key = string(const_char_ptr_cast(stream.GetData()), stream.GetPosition());
+	statement.result_cache_tables = std::move(tables);
+}
+
 shared_ptr<PreparedStatementData>
 ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const string &query,
                                                unique_ptr<SQLStatement> statement,
@@ -351,6 +503,9 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 #ifdef DEBUG
 	plan->Verify(*this);
 #endif
+	if (DBConfig::GetConfig(*this).options.enable_query_result_cache) {
+		SetResultCacheKey(*result, *plan);
+	}
 	if (config.enable_optimizer && plan->RequireOptimizer()) {
 		profiler.StartPhase("optimizer");
 		Optimizer optimizer(*planner.binder, *this);
@@ -475,14 +630,74 @@ void ClientContext::CheckIfPreparedStatementIsExecutable(PreparedStatementData &
 	}
 }
 
+//! Gets the current versions of the tables that are read by a statement, returns false if the transaction cannot share
+//! results with other transactions (i.e. if it has made changes, or it does not see the latest version of a table)
+static bool GetResultCacheDependencies(ClientContext &context, PreparedStatementData &statement,
+                                       vector<QueryResultCacheDependency> &dependencies) {
+	for (auto &table_ref : statement.result_cache_tables) {
+		auto table = table_ref.lock();
+		if (!table) {
+			return false;
+		}
+		auto &transaction = DuckTransaction::Get(context, table->GetDB());
+		auto commit_version = table->GetCommitVersion();
+		if (transaction.ChangesMade() || commit_version >= transaction.start_time) {
+			return false;
+		}
+		QueryResultCacheDependency dependency;
+		dependency.table = table;
+		dependency.commit_version = commit_version;
+		dependencies.push_back(std::move(dependency));
+	}
+	return true;
+}
+
+static string GetResultCacheKey(PreparedStatementData &statement) {
+	// the key is the bound plan together with the values of the parameters
+	vector<pair<string, string>> parameters;
+	for (auto &entry : statement.value_map) {
+		auto &value = entry.second->GetValue();
+		parameters.emplace_back(entry.first, value.type().ToString() + ":" + value.ToSQLString());
+	}
+	std::sort(parameters.begin(), parameters.end());
+	auto key = statement.result_cache_key;
+	for (auto &parameter : parameters) {
+		key += to_string(parameter.first.size()) + ":" + parameter.first;
+		key += to_string(parameter.second.size()) + ":" + parameter.second;
+	}
+	return key;
+}
+
 unique_ptr<PendingQueryResult>
 ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_ptr<PreparedStatementData> statement_p,
                                                 const PendingQueryParameters &parameters) {
 	D_ASSERT(active_query);
+	BindPreparedStatementParameters(*statement_p, parameters);
+
+	if (!statement_p->result_cache_key.empty() && DBConfig::GetConfig(*this).options.enable_query_result_cache) {
+		vector<QueryResultCacheDependency> dependencies;
+		if (GetResultCacheDependencies(*this, *statement_p, dependencies)) {
+			auto key = GetResultCacheKey(*statement_p);
+			auto cached_result = QueryResultCache::Get(*this).Lookup(key, dependencies);
+			if (cached_result) {
+				// cache hit: scan the cached result instead of executing the plan
+				auto cached_statement = make_shared_ptr<PreparedStatementData>(statement_p->statement_type);
+				cached_statement->names = statement_p->names;
+				cached_statement->types = statement_p->types;
+				cached_statement->properties = statement_p->properties;
+				cached_statement->plan =
+				    make_uniq<PhysicalColumnDataScan>(statement_p->types, PhysicalOperatorType::RESULT_CACHE_SCAN,
+				                                      cached_result->Count(), *cached_result);
+				active_query->cached_result = std::move(cached_result);
+				statement_p = std::move(cached_statement);
+			} else {
+				active_query->result_cache_key = std::move(key);
+				active_query->result_cache_dependencies = std::move(dependencies);
+			}
+		}
+	}
 	auto &statement = *statement_p;
 
-	BindPreparedStatementParameters(statement, parameters);
-
 	active_query->executor = make_uniq<Executor>(*this);
 	auto &executor = *active_query->executor;
 	if (config.enable_progress_bar) {
@@ -1122,7 +1337,8 @@ unique_ptr<TableDescription> ClientContext::TableInfo(const string &schema_name,
 }
 
 void ClientContext::Append(TableDescription &description, ColumnDataCollection &collection) {
-	RunFunctionInTransaction([&]() {
+	auto lock = LockContext();
+	RunFunctionInTransactionInternal(*lock, [&]() {
 		auto &table_entry =
 		    Catalog::GetEntry<TableCatalogEntry>(*this, INVALID_CATALOG, description.schema, description.table);
 		// verify that the table columns and types match up
@@ -1137,7 +1353,15 @@ void ClientContext::Append(TableDescription &description, ColumnDataCollection &
 		auto binder = Binder::CreateBinder(*this);
 		auto bound_constraints = binder->BindConstraints(table_entry);
 		MetaTransaction::Get(*this).ModifyDatabase(table_entry.ParentCatalog().GetAttached());
+		MaterializedViewMaintenance::VerifyModification(*this, table_entry);
 		table_entry.GetStorage().LocalAppend(table_entry, *this, collection, bound_constraints);
+		if (MaterializedViewMaintenance::HasMaterializedViews(*this, table_entry)) {
+			auto &maintenance = MaterializedViewMaintenance::Get(*this);
+			for (auto &chunk : collection.Chunks()) {
+				maintenance.AddInsertedRows(*this, table_entry, chunk);
+			}
+			MaintainMaterializedViews(*lock);
+		}
 	});
 }
 
@@ -11,6 +11,7 @@
 #include "duckdb/main/client_context_file_opener.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/materialized_view_maintenance.hpp"
 #include "duckdb/main/query_profiler.hpp"
 
 namespace duckdb {
@@ -42,6 +43,7 @@ ClientData::ClientData(ClientContext &context) : catalog_search_path(make_uniq<C
 	random_engine = make_uniq<RandomEngine>();
 	file_opener = make_uniq<ClientContextFileOpener>(context);
 	client_file_system = make_uniq<ClientFileSystem>(context);
+	materialized_view_maintenance = make_uniq<MaterializedViewMaintenance>();
 	temporary_objects->Initialize(DEFAULT_BLOCK_ALLOC_SIZE);
 }
 
@@ -61,6 +61,10 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AllowPersistentSecrets),
     DUCKDB_GLOBAL(CatalogErrorMaxSchema),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
+    DUCKDB_GLOBAL(WALCommitDelaySetting),
+    DUCKDB_GLOBAL(WALAsyncCommitSetting),
+    DUCKDB_GLOBAL(CompactionThresholdSetting),
+    DUCKDB_GLOBAL(CompactionRowLimitSetting),
     DUCKDB_GLOBAL(DebugCheckpointAbort),
     DUCKDB_GLOBAL(DebugSkipCheckpointOnCommit),
     DUCKDB_GLOBAL(StorageCompatibilityVersion),
@@ -85,8 +89,11 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AutoinstallKnownExtensions),
     DUCKDB_GLOBAL(AutoloadKnownExtensions),
     DUCKDB_GLOBAL(EnableObjectCacheSetting),
+    DUCKDB_GLOBAL(EnableQueryResultCacheSetting),
+    DUCKDB_GLOBAL(QueryResultCacheLimitSetting),
     DUCKDB_GLOBAL(EnableHTTPMetadataCacheSetting),
     DUCKDB_LOCAL(EnableProfilingSetting),
+    DUCKDB_LOCAL(EnableCompiledExpressionsSetting),
     DUCKDB_LOCAL(EnableProgressBarSetting),
     DUCKDB_LOCAL(EnableProgressBarPrintSetting),
     DUCKDB_LOCAL(ErrorsAsJsonSetting),
@@ -129,7 +136,9 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
+    DUCKDB_GLOBAL(AsyncIOThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
     DUCKDB_GLOBAL(ArrowOutputListView),
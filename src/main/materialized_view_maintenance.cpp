@@ -0,0 +1,885 @@
+#include "duckdb/main/materialized_view_maintenance.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/catalog/dependency_manager.hpp"
+#include "duckdb/catalog/duck_catalog.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/parser/expression/columnref_expression.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/parser/expression/function_expression.hpp"
+#include "duckdb/parser/expression/positional_reference_expression.hpp"
+#include "duckdb/parser/expression/subquery_expression.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/parser/parsed_expression_iterator.hpp"
+#include "duckdb/parser/parser.hpp"
+#include "duckdb/parser/query_node/cte_node.hpp"
+#include "duckdb/parser/query_node/recursive_cte_node.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/query_node/set_operation_node.hpp"
+#include "duckdb/parser/statement/delete_statement.hpp"
+#include "duckdb/parser/statement/insert_statement.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/statement/update_statement.hpp"
+#include "duckdb/parser/tableref/basetableref.hpp"
+#include "duckdb/parser/tableref/column_data_ref.hpp"
+#include "duckdb/parser/tableref/expressionlistref.hpp"
+#include "duckdb/parser/tableref/joinref.hpp"
+#include "duckdb/parser/tableref/pivotref.hpp"
+#include "duckdb/parser/tableref/subqueryref.hpp"
+#include "duckdb/parser/tableref/table_function_ref.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+typedef std::function<void(unique_ptr<TableRef> &ref)> table_ref_callback_t;
+typedef std::function<void(QueryNode &node)> query_node_callback_t;
+
+MaterializedViewMaintenance &MaterializedViewMaintenance::Get(ClientContext &context) {
+	return *ClientData::Get(context).materialized_view_maintenance;
+}
+
+//===--------------------------------------------------------------------===//
+// Dependent Views
+//===--------------------------------------------------------------------===//
+static vector<reference<TableCatalogEntry>> GetMaterializedViews(ClientContext &context, TableCatalogEntry &table) {
+	vector<reference<TableCatalogEntry>> result;
+	auto &catalog = table.ParentCatalog();
+	if (!catalog.IsDuckCatalog()) {
+		return result;
+	}
+	auto &dependency_manager = catalog.Cast<DuckCatalog>().GetDependencyManager();
+	dependency_manager.ScanDependentEntries(catalog.GetCatalogTransaction(context), table, [&](CatalogEntry &entry) {
+		if (entry.type != CatalogType::TABLE_ENTRY) {
+			return;
+		}
+		auto &dependent = entry.Cast<TableCatalogEntry>();
+		if (dependent.IsMaterializedView()) {
+			result.push_back(dependent);
+		}
+	});
+	return result;
+}
+
+bool MaterializedViewMaintenance::HasMaterializedViews(ClientContext &context, TableCatalogEntry &table) {
+	return !GetMaterializedViews(context, table).empty();
+}
+
+void MaterializedViewMaintenance::VerifyModification(ClientContext &context, TableCatalogEntry &table) {
+	if (!table.IsMaterializedView() || Get(context).IsMaintaining()) {
+		return;
+	}
+	throw BinderException("Cannot modify materialized view \"%s\" - it is kept up to date with the tables it reads from",
+	                      table.name);
+}
+
+//===--------------------------------------------------------------------===//
+// Change Capture
+//===--------------------------------------------------------------------===//
+MaterializedViewDelta &MaterializedViewMaintenance::GetDelta(ClientContext &context, TableCatalogEntry &table) {
+	for (auto &delta : deltas) {
+		if (&delta->table == &table) {
+			return *delta;
+		}
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	auto delta = make_uniq<MaterializedViewDelta>(table);
+	delta->inserted = make_shared_ptr<ColumnDataCollection>(buffer_manager, table.GetTypes());
+	delta->deleted = make_shared_ptr<ColumnDataCollection>(buffer_manager, table.GetTypes());
+	deltas.push_back(std::move(delta));
+	return *deltas.back();
+}
+
+void MaterializedViewMaintenance::AddInsertedRows(ClientContext &context, TableCatalogEntry &table, DataChunk &chunk) {
+	if (chunk.size() == 0) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	auto &delta = GetDelta(context, table);
+	if (delta.requires_refresh) {
+		return;
+	}
+	delta.inserted->Append(chunk);
+}
+
+void MaterializedViewMaintenance::AddDeletedRows(ClientContext &context, TableCatalogEntry &table, Vector &row_ids,
+                                                 idx_t count) {
+	AddDeletedRowsInternal(context, table, row_ids, count, nullptr, nullptr);
+}
+
+void MaterializedViewMaintenance::AddUpdatedRows(ClientContext &context, TableCatalogEntry &table, Vector &row_ids,
+                                                 const vector<PhysicalIndex> &columns, DataChunk &updates) {
+	AddDeletedRowsInternal(context, table, row_ids, updates.size(), &columns, &updates);
+}
+
+void MaterializedViewMaintenance::AddDeletedRowsInternal(ClientContext &context, TableCatalogEntry &table,
+                                                         Vector &row_ids, idx_t count,
+                                                         optional_ptr<const vector<PhysicalIndex>> columns,
+                                                         optional_ptr<DataChunk> updates) {
+	if (count == 0) {
+		return;
+	}
+	D_ASSERT(count <= STANDARD_VECTOR_SIZE);
+	lock_guard<mutex> guard(lock);
+	auto &delta = GetDelta(context, table);
+	if (delta.requires_refresh) {
+		return;
+	}
+	UnifiedVectorFormat id_data;
+	row_ids.ToUnifiedFormat(count, id_data);
+	auto ids = UnifiedVectorFormat::GetData<row_t>(id_data);
+
+	// split the rows into rows of the table and transaction-local rows, they are fetched from different places
+	SelectionVector sel[2] = {SelectionVector(STANDARD_VECTOR_SIZE), SelectionVector(STANDARD_VECTOR_SIZE)};
+	idx_t sel_count[2] = {0, 0};
+	for (idx_t i = 0; i < count; i++) {
+		auto row_id = ids[id_data.sel->get_index(i)];
+		if (!delta.deleted_row_ids.insert(row_id).second) {
+			if (updates) {
+				// the same row is updated more than once - we do not know which version ends up in the table
+				delta.requires_refresh = true;
+				return;
+			}
+			// the row was already deleted
+			continue;
+		}
+		idx_t local = row_id >= MAX_ROW_ID ? 1 : 0;
+		sel[local].set_index(sel_count[local]++, i);
+	}
+
+	auto &transaction = DuckTransaction::Get(context, table.ParentCatalog());
+	auto &storage = table.GetStorage();
+	auto types = table.GetTypes();
+	vector<column_t> column_ids;
+	for (idx_t i = 0; i < types.size(); i++) {
+		column_ids.push_back(i);
+	}
+	for (idx_t local = 0; local < 2; local++) {
+		if (sel_count[local] == 0) {
+			continue;
+		}
+		Vector fetch_ids(LogicalType::ROW_TYPE);
+		auto fetch_data = FlatVector::GetData<row_t>(fetch_ids);
+		for (idx_t i = 0; i < sel_count[local]; i++) {
+			fetch_data[i] = ids[id_data.sel->get_index(sel[local].get_index(i))];
+		}
+		DataChunk rows;
+		rows.Initialize(Allocator::Get(context), types);
+		ColumnFetchState fetch_state;
+		if (local) {
+			LocalStorage::Get(transaction).FetchChunk(storage, fetch_ids, sel_count[local], column_ids, rows,
+			                                          fetch_state);
+		} else {
+			storage.Fetch(transaction, rows, column_ids, fetch_ids, sel_count[local], fetch_state);
+		}
+		if (rows.size() != sel_count[local]) {
+			// not all rows are visible - bail out
+			delta.requires_refresh = true;
+			return;
+		}
+		delta.deleted->Append(rows);
+		if (!updates) {
+			continue;
+		}
+		// the new version of the rows is the old version with the updated columns replaced
+		for (idx_t u = 0; u < columns->size(); u++) {
+			rows.data[(*columns)[u].index].Slice(updates->data[u], sel[local], sel_count[local]);
+		}
+		delta.inserted->Append(rows);
+	}
+}
+
+void MaterializedViewMaintenance::RequireRefresh(ClientContext &context, TableCatalogEntry &table) {
+	lock_guard<mutex> guard(lock);
+	GetDelta(context, table).requires_refresh = true;
+}
+
+bool MaterializedViewMaintenance::HasChanges() {
+	lock_guard<mutex> guard(lock);
+	return !deltas.empty();
+}
+
+void MaterializedViewMaintenance::Clear() {
+	lock_guard<mutex> guard(lock);
+	deltas.clear();
+}
+
+//===--------------------------------------------------------------------===//
+// Query Traversal
+//===--------------------------------------------------------------------===//
+static void EnumerateTableRef(unique_ptr<TableRef> &ref, const table_ref_callback_t &callback,
+                              const query_node_callback_t &node_callback);
+
+static void EnumerateExpressionTableRefs(ParsedExpression &expr, const table_ref_callback_t &callback,
+                                         const query_node_callback_t &node_callback) {
+	if (expr.GetExpressionClass() == ExpressionClass::SUBQUERY) {
+		auto &subquery = expr.Cast<SubqueryExpression>();
+		MaterializedViewMaintenance::EnumerateTableRefs(*subquery.subquery->node, callback, node_callback);
+	}
+	ParsedExpressionIterator::EnumerateChildren(
+	    expr, [&](ParsedExpression &child) { EnumerateExpressionTableRefs(child, callback, node_callback); });
+}
+
+static void EnumerateTableRef(unique_ptr<TableRef> &ref, const table_ref_callback_t &callback,
+                              const query_node_callback_t &node_callback) {
+	switch (ref->type) {
+	case TableReferenceType::JOIN: {
+		auto &join = ref->Cast<JoinRef>();
+		EnumerateTableRef(join.left, callback, node_callback);
+		EnumerateTableRef(join.right, callback, node_callback);
+		if (join.condition) {
+			EnumerateExpressionTableRefs(*join.condition, callback, node_callback);
+		}
+		break;
+	}
+	case TableReferenceType::SUBQUERY:
+		MaterializedViewMaintenance::EnumerateTableRefs(*ref->Cast<SubqueryRef>().subquery->node, callback,
+		                                                node_callback);
+		break;
+	case TableReferenceType::PIVOT:
+		EnumerateTableRef(ref->Cast<PivotRef>().source, callback, node_callback);
+		break;
+	case TableReferenceType::TABLE_FUNCTION:
+		EnumerateExpressionTableRefs(*ref->Cast<TableFunctionRef>().function, callback, node_callback);
+		break;
+	case TableReferenceType::EXPRESSION_LIST:
+		for (auto &row : ref->Cast<ExpressionListRef>().values) {
+			for (auto &value : row) {
+				EnumerateExpressionTableRefs(*value, callback, node_callback);
+			}
+		}
+		break;
+	default:
+		break;
+	}
+	callback(ref);
+}
+
+void MaterializedViewMaintenance::EnumerateTableRefs(QueryNode &node, const table_ref_callback_t &callback,
+                                                     const query_node_callback_t &node_callback) {
+	if (node_callback) {
+		node_callback(node);
+	}
+	for (auto &cte : node.cte_map.map) {
+		EnumerateTableRefs(*cte.second->query->node, callback, node_callback);
+	}
+	auto expression_callback = [&](unique_ptr<ParsedExpression> &child) {
+		EnumerateExpressionTableRefs(*child, callback, node_callback);
+	};
+	switch (node.type) {
+	case QueryNodeType::SELECT_NODE: {
+		auto &select = node.Cast<SelectNode>();
+		for (auto &expr : select.select_list) {
+			expression_callback(expr);
+		}
+		for (auto &expr : select.groups.group_expressions) {
+			expression_callback(expr);
+		}
+		if (select.where_clause) {
+			expression_callback(select.where_clause);
+		}
+		if (select.having) {
+			expression_callback(select.having);
+		}
+		if (select.qualify) {
+			expression_callback(select.qualify);
+		}
+		if (select.from_table) {
+			EnumerateTableRef(select.from_table, callback, node_callback);
+		}
+		break;
+	}
+	case QueryNodeType::SET_OPERATION_NODE: {
+		auto &setop = node.Cast<SetOperationNode>();
+		EnumerateTableRefs(*setop.left, callback, node_callback);
+		EnumerateTableRefs(*setop.right, callback, node_callback);
+		break;
+	}
+	case QueryNodeType::RECURSIVE_CTE_NODE: {
+		auto &cte = node.Cast<RecursiveCTENode>();
+		EnumerateTableRefs(*cte.left, callback, node_callback);
+		EnumerateTableRefs(*cte.right, callback, node_callback);
+		break;
+	}
+	case QueryNodeType::CTE_NODE: {
+		auto &cte = node.Cast<CTENode>();
+		EnumerateTableRefs(*cte.query, callback, node_callback);
+		EnumerateTableRefs(*cte.child, callback, node_callback);
+		break;
+	}
+	default:
+		throw InternalException("Unsupported query node type in MaterializedViewMaintenance::EnumerateTableRefs");
+	}
+	ParsedExpressionIterator::EnumerateQueryNodeModifiers(node, expression_callback);
+}
+
+//===--------------------------------------------------------------------===//
+// Statement Construction
+//===--------------------------------------------------------------------===//
+static string QuoteName(const string &name) {
+	return KeywordHelper::WriteOptionallyQuoted(name);
+}
+
+static string QualifiedName(TableCatalogEntry &table) {
+	return QuoteName(table.ParentCatalog().GetName()) + "." + QuoteName(table.schema.name) + "." +
+	       QuoteName(table.name);
+}
+
+static vector<string> ColumnNames(TableCatalogEntry &table) {
+	vector<string> result;
+	for (auto &column : table.GetColumns().Physical()) {
+		result.push_back(column.Name());
+	}
+	return result;
+}
+
+//! Equality conditions on the group keys of two relations, NULL keys are considered equal
+static string KeyCondition(const vector<string> &names, const vector<idx_t> &keys, const string &left,
+                           const string &right) {
+	string result;
+	for (auto &key : keys) {
+		if (!result.empty()) {
+			result += " AND ";
+		}
+		auto name = QuoteName(names[key]);
+		result += left + "." + name + " IS NOT DISTINCT FROM " + right + "." + name;
+	}
+	return result;
+}
+
+static unique_ptr<SQLStatement> ParseStatement(ClientContext &context, const string &query) {
+	Parser parser(context.GetParserOptions());
+	parser.ParseQuery(query);
+	if (parser.statements.size() != 1) {
+		throw InternalException("Expected a single statement in materialized view maintenance");
+	}
+	return std::move(parser.statements[0]);
+}
+
+//! Replaces the (unqualified) placeholder table with the given table reference
+static void ReplacePlaceholder(SQLStatement &statement, const string &name, unique_ptr<TableRef> replacement) {
+	table_ref_callback_t callback = [&](unique_ptr<TableRef> &ref) {
+		if (ref->type != TableReferenceType::BASE_TABLE || !replacement) {
+			return;
+		}
+		auto &base = ref->Cast<BaseTableRef>();
+		if (!base.schema_name.empty() || base.table_name != name) {
+			return;
+		}
+		replacement->alias = base.alias.empty() ? name : base.alias;
+		ref = std::move(replacement);
+	};
+	switch (statement.type) {
+	case StatementType::SELECT_STATEMENT:
+		MaterializedViewMaintenance::EnumerateTableRefs(*statement.Cast<SelectStatement>().node, callback);
+		break;
+	case StatementType::INSERT_STATEMENT:
+		MaterializedViewMaintenance::EnumerateTableRefs(*statement.Cast<InsertStatement>().select_statement->node,
+		                                                callback);
+		break;
+	case StatementType::UPDATE_STATEMENT: {
+		auto &update = statement.Cast<UpdateStatement>();
+		if (update.from_table) {
+			EnumerateTableRef(update.from_table, callback, nullptr);
+		}
+		break;
+	}
+	case StatementType::DELETE_STATEMENT:
+		for (auto &using_clause : statement.Cast<DeleteStatement>().using_clauses) {
+			EnumerateTableRef(using_clause, callback, nullptr);
+		}
+		break;
+	default:
+		break;
+	}
+	if (replacement) {
+		throw InternalException("Placeholder \"%s\" not found in materialized view maintenance", name);
+	}
+}
+
+//! Wraps a query node in a subquery that has the column names of the view
+static unique_ptr<TableRef> ViewSubquery(TableCatalogEntry &view, unique_ptr<QueryNode> node) {
+	auto select = make_uniq<SelectStatement>();
+	select->node = std::move(node);
+	auto result = make_uniq<SubqueryRef>(std::move(select));
+	result->column_name_alias = ColumnNames(view);
+	return std::move(result);
+}
+
+//! Returns a copy of the query of the view
+static unique_ptr<QueryNode> GetViewQuery(TableCatalogEntry &view) {
+	auto node = view.GetMaterializedViewQuery().node->Copy();
+	// the tables are qualified when the view is created - refer to them through the current name of the database
+	auto &catalog_name = view.ParentCatalog().GetName();
+	MaterializedViewMaintenance::EnumerateTableRefs(*node, [&](unique_ptr<TableRef> &ref) {
+		if (ref->type != TableReferenceType::BASE_TABLE) {
+			return;
+		}
+		auto &base = ref->Cast<BaseTableRef>();
+		if (!base.schema_name.empty()) {
+			base.catalog_name = catalog_name;
+		}
+	});
+	return node;
+}
+
+static bool IsTableReference(TableRef &ref, TableCatalogEntry &table) {
+	if (ref.type != TableReferenceType::BASE_TABLE) {
+		return false;
+	}
+	auto &base = ref.Cast<BaseTableRef>();
+	return StringUtil::CIEquals(base.catalog_name, table.ParentCatalog().GetName()) &&
+	       StringUtil::CIEquals(base.schema_name, table.schema.name) && StringUtil::CIEquals(base.table_name, table.name);
+}
+
+//! Finds the reference to the table in the FROM clause, the delta can only be pushed through inner joins
+static optional_ptr<unique_ptr<TableRef>> FindDeltaReference(unique_ptr<TableRef> &ref, TableCatalogEntry &table) {
+	if (IsTableReference(*ref, table)) {
+		return &ref;
+	}
+	if (ref->type != TableReferenceType::JOIN) {
+		return nullptr;
+	}
+	auto &join = ref->Cast<JoinRef>();
+	if (join.type != JoinType::INNER) {
+		return nullptr;
+	}
+	switch (join.ref_type) {
+	case JoinRefType::REGULAR:
+	case JoinRefType::NATURAL:
+	case JoinRefType::CROSS:
+		break;
+	default:
+		return nullptr;
+	}
+	auto result = FindDeltaReference(join.left, table);
+	if (result) {
+		return result;
+	}
+	return FindDeltaReference(join.right, table);
+}
+
+//! Returns the query of the view, with the table replaced by the given rows
+static unique_ptr<QueryNode> GetDeltaQuery(TableCatalogEntry &view, TableCatalogEntry &table,
+                                           shared_ptr<ColumnDataCollection> rows, bool remove_having) {
+	auto node = GetViewQuery(view);
+	auto &select = node->Cast<SelectNode>();
+	auto delta_ref = FindDeltaReference(select.from_table, table);
+	if (!delta_ref) {
+		throw InternalException("Table not found in the query of the materialized view");
+	}
+	auto &base = (*delta_ref)->Cast<BaseTableRef>();
+	auto names = ColumnNames(table);
+	for (idx_t i = 0; i < base.column_name_alias.size() && i < names.size(); i++) {
+		names[i] = base.column_name_alias[i];
+	}
+	auto replacement = make_uniq<ColumnDataRef>(std::move(rows), std::move(names));
+	replacement->alias = base.alias.empty() ? base.table_name : base.alias;
+	*delta_ref = std::move(replacement);
+	if (remove_having) {
+		select.having.reset();
+	}
+	return node;
+}
+
+static unique_ptr<ColumnDataCollection> MaterializeQuery(ClientContext &context, TableCatalogEntry &view,
+                                                         unique_ptr<QueryNode> node,
+                                                         const maintenance_execute_t &execute) {
+	auto statement = ParseStatement(context, "SELECT * FROM __mv_query");
+	ReplacePlaceholder(*statement, "__mv_query", ViewSubquery(view, std::move(node)));
+	return execute(std::move(statement))->TakeCollection();
+}
+
+static void InsertQuery(ClientContext &context, TableCatalogEntry &view, unique_ptr<QueryNode> node,
+                        const maintenance_execute_t &execute) {
+	auto statement = ParseStatement(context, "INSERT INTO " + QualifiedName(view) + " SELECT * FROM __mv_query");
+	ReplacePlaceholder(*statement, "__mv_query", ViewSubquery(view, std::move(node)));
+	execute(std::move(statement));
+}
+
+static void RefreshView(ClientContext &context, TableCatalogEntry &view, const maintenance_execute_t &execute) {
+	execute(ParseStatement(context, "DELETE FROM " + QualifiedName(view)));
+	InsertQuery(context, view, GetViewQuery(view), execute);
+}
+
+//===--------------------------------------------------------------------===//
+// View Analysis
+//===--------------------------------------------------------------------===//
+enum class MaintenanceColumnType : uint8_t { GROUP, SUM, COUNT, OTHER };
+
+struct MaterializedViewAnalysis {
+	//! Whether or not the view can be maintained incrementally
+	bool incremental = false;
+	//! Whether or not the view is an aggregate
+	bool aggregate = false;
+	//! Whether or not the aggregates of the view can be merged with the aggregates of new rows
+	bool mergeable = false;
+	//! The output columns that contain the group keys
+	vector<idx_t> group_columns;
+	//! How every output column is maintained
+	vector<MaintenanceColumnType> column_types;
+};
+
+struct ExpressionAnalysis {
+	bool has_aggregate = false;
+	bool has_window = false;
+	//! Whether or not the expression calls a function that is not a built-in scalar or aggregate (e.g. a macro)
+	bool has_unknown_function = false;
+};
+
+static void AnalyzeExpression(ClientContext &context, ParsedExpression &expr, ExpressionAnalysis &result) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::FUNCTION: {
+		auto &function = expr.Cast<FunctionExpression>();
+		// scalar functions, aggregates and macros share a catalog set
+		auto entry = Catalog::GetEntry(context, CatalogType::SCALAR_FUNCTION_ENTRY, function.catalog, function.schema,
+		                               function.function_name, OnEntryNotFound::RETURN_NULL);
+		if (entry && entry->type == CatalogType::AGGREGATE_FUNCTION_ENTRY) {
+			result.has_aggregate = true;
+			return;
+		}
+		if (!entry || entry->type != CatalogType::SCALAR_FUNCTION_ENTRY) {
+			result.has_unknown_function = true;
+		}
+		break;
+	}
+	case ExpressionClass::WINDOW:
+		result.has_window = true;
+		return;
+	case ExpressionClass::SUBQUERY:
+		// subqueries are evaluated on their own
+		return;
+	default:
+		break;
+	}
+	ParsedExpressionIterator::EnumerateChildren(expr,
+	                                            [&](ParsedExpression &child) { AnalyzeExpression(context, child, result); });
+}
+
+//! Returns the output column that the group expression refers to, or DConstants::INVALID_INDEX
+static idx_t FindGroupColumn(SelectNode &select, ParsedExpression &group) {
+	auto &select_list = select.select_list;
+	if (group.GetExpressionClass() == ExpressionClass::CONSTANT) {
+		auto &value = group.Cast<ConstantExpression>().value;
+		if (value.type().IsIntegral() && !value.IsNull()) {
+			auto index = value.GetValue<int64_t>();
+			if (index >= 1 && index <= int64_t(select_list.size())) {
+				return idx_t(index - 1);
+			}
+		}
+		return DConstants::INVALID_INDEX;
+	}
+	if (group.GetExpressionClass() == ExpressionClass::POSITIONAL_REFERENCE) {
+		auto index = group.Cast<PositionalReferenceExpression>().index;
+		if (index >= 1 && index <= select_list.size()) {
+			return index - 1;
+		}
+		return DConstants::INVALID_INDEX;
+	}
+	if (group.GetExpressionClass() == ExpressionClass::COLUMN_REF) {
+		auto &colref = group.Cast<ColumnRefExpression>();
+		if (!colref.IsQualified()) {
+			for (idx_t i = 0; i < select_list.size(); i++) {
+				if (StringUtil::CIEquals(select_list[i]->alias, colref.GetColumnName())) {
+					return i;
+				}
+			}
+		}
+	}
+	for (idx_t i = 0; i < select_list.size(); i++) {
+		if (select_list[i]->Equals(group)) {
+			return i;
+		}
+	}
+	return DConstants::INVALID_INDEX;
+}
+
+static MaintenanceColumnType GetMergeType(ParsedExpression &expr) {
+	if (expr.GetExpressionClass() != ExpressionClass::FUNCTION) {
+		return MaintenanceColumnType::OTHER;
+	}
+	auto &function = expr.Cast<FunctionExpression>();
+	if (!function.catalog.empty() || !function.schema.empty() || function.distinct || function.filter ||
+	    (function.order_bys && !function.order_bys->orders.empty())) {
+		return MaintenanceColumnType::OTHER;
+	}
+	auto name = StringUtil::Lower(function.function_name);
+	if (name == "sum" && function.children.size() == 1) {
+		return MaintenanceColumnType::SUM;
+	}
+	if ((name == "count" && function.children.size() <= 1) || name == "count_star") {
+		return MaintenanceColumnType::COUNT;
+	}
+	return MaintenanceColumnType::OTHER;
+}
+
+static MaterializedViewAnalysis AnalyzeView(ClientContext &context, QueryNode &node, TableCatalogEntry &table) {
+	MaterializedViewAnalysis result;
+	// the table must be read exactly once
+	idx_t reference_count = 0;
+	MaterializedViewMaintenance::EnumerateTableRefs(node, [&](unique_ptr<TableRef> &ref) {
+		if (IsTableReference(*ref, table)) {
+			reference_count++;
+		}
+	});
+	if (reference_count != 1 || node.type != QueryNodeType::SELECT_NODE || !node.cte_map.map.empty()) {
+		return result;
+	}
+	for (auto &modifier : node.modifiers) {
+		if (modifier->type != ResultModifierType::ORDER_MODIFIER) {
+			return result;
+		}
+	}
+	auto &select = node.Cast<SelectNode>();
+	if (select.qualify || select.sample || !select.from_table || !FindDeltaReference(select.from_table, table)) {
+		return result;
+	}
+	vector<ExpressionAnalysis> items;
+	for (auto &expr : select.select_list) {
+		ExpressionAnalysis item;
+		AnalyzeExpression(context, *expr, item);
+		if (item.has_window || item.has_unknown_function) {
+			return result;
+		}
+		result.aggregate = result.aggregate || item.has_aggregate;
+		items.push_back(item);
+	}
+	if (select.having) {
+		ExpressionAnalysis having;
+		AnalyzeExpression(context, *select.having, having);
+		if (having.has_window || having.has_unknown_function) {
+			return result;
+		}
+		result.aggregate = true;
+	}
+	if (!select.groups.group_expressions.empty() || select.aggregate_handling == AggregateHandling::FORCE_AGGREGATES) {
+		result.aggregate = true;
+	}
+	if (!result.aggregate) {
+		result.incremental = true;
+		return result;
+	}
+
+	// figure out which output columns hold the group keys
+	result.column_types.resize(items.size(), MaintenanceColumnType::OTHER);
+	if (select.groups.grouping_sets.size() > 1) {
+		return result;
+	}
+	if (select.aggregate_handling == AggregateHandling::FORCE_AGGREGATES) {
+		for (idx_t i = 0; i < items.size(); i++) {
+			if (!items[i].has_aggregate) {
+				result.column_types[i] = MaintenanceColumnType::GROUP;
+			}
+		}
+	} else {
+		for (auto &group : select.groups.group_expressions) {
+			auto column = FindGroupColumn(select, *group);
+			if (column == DConstants::INVALID_INDEX || items[column].has_aggregate) {
+				return result;
+			}
+			result.column_types[column] = MaintenanceColumnType::GROUP;
+		}
+	}
+	result.mergeable = !select.having;
+	for (idx_t i = 0; i < items.size(); i++) {
+		if (result.column_types[i] == MaintenanceColumnType::GROUP) {
+			result.group_columns.push_back(i);
+			continue;
+		}
+		result.column_types[i] = GetMergeType(*select.select_list[i]);
+		if (result.column_types[i] == MaintenanceColumnType::OTHER) {
+			result.mergeable = false;
+		}
+	}
+	result.incremental = true;
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Maintenance
+//===--------------------------------------------------------------------===//
+//! Merges the aggregates over the new rows into the existing groups of the view
+static void MergeGroups(ClientContext &context, TableCatalogEntry &view, TableCatalogEntry &table,
+                        MaterializedViewDelta &delta, MaterializedViewAnalysis &analysis,
+                        const maintenance_execute_t &execute) {
+	shared_ptr<ColumnDataCollection> changes =
+	    MaterializeQuery(context, view, GetDeltaQuery(view, table, delta.inserted, false), execute);
+	if (changes->Count() == 0) {
+		return;
+	}
+	auto names = ColumnNames(view);
+	auto view_name = QualifiedName(view);
+	auto key_condition = KeyCondition(names, analysis.group_columns, "__mv_view", "__mv_delta");
+
+	string set_list;
+	for (idx_t i = 0; i < names.size(); i++) {
+		auto view_column = "__mv_view." + QuoteName(names[i]);
+		auto delta_column = "__mv_delta." + QuoteName(names[i]);
+		string merged;
+		switch (analysis.column_types[i]) {
+		case MaintenanceColumnType::SUM:
+			// the SUM over no (non-NULL) values is NULL
+			merged = StringUtil::Format("CASE WHEN %s IS NULL THEN %s WHEN %s IS NULL THEN %s ELSE %s + %s END",
+			                            delta_column, view_column, view_column, delta_column, view_column,
+			                            delta_column);
+			break;
+		case MaintenanceColumnType::COUNT:
+			merged = view_column + " + " + delta_column;
+			break;
+		default:
+			continue;
+		}
+		if (!set_list.empty()) {
+			set_list += ", ";
+		}
+		set_list += QuoteName(names[i]) + " = " + merged;
+	}
+	if (!set_list.empty()) {
+		auto query = "UPDATE " + view_name + " AS __mv_view SET " + set_list + " FROM __mv_delta";
+		if (!key_condition.empty()) {
+			query += " WHERE " + key_condition;
+		}
+		auto statement = ParseStatement(context, query);
+		ReplacePlaceholder(*statement, "__mv_delta", make_uniq<ColumnDataRef>(changes, names));
+		execute(std::move(statement));
+	}
+	if (analysis.group_columns.empty()) {
+		// a global aggregate always has exactly one row
+		return;
+	}
+	// add the groups that do not exist yet
+	auto statement = ParseStatement(context, "INSERT INTO " + view_name +
+	                                             " SELECT __mv_delta.* FROM __mv_delta ANTI JOIN " + view_name +
+	                                             " AS __mv_view ON " + key_condition);
+	ReplacePlaceholder(*statement, "__mv_delta", make_uniq<ColumnDataRef>(changes, names));
+	execute(std::move(statement));
+}
+
+//! Recomputes the groups of the view that are affected by the changed rows
+static void RecomputeGroups(ClientContext &context, TableCatalogEntry &view, TableCatalogEntry &table,
+                            MaterializedViewDelta &delta, MaterializedViewAnalysis &analysis,
+                            const maintenance_execute_t &execute) {
+	// the HAVING clause is dropped so that groups that no longer (or not yet) qualify are found as well
+	shared_ptr<ColumnDataCollection> affected_groups =
+	    MaterializeQuery(context, view, GetDeltaQuery(view, table, delta.inserted, true), execute);
+	auto deleted_groups = MaterializeQuery(context, view, GetDeltaQuery(view, table, delta.deleted, true), execute);
+	for (auto &chunk : deleted_groups->Chunks()) {
+		affected_groups->Append(chunk);
+	}
+	if (affected_groups->Count() == 0) {
+		return;
+	}
+	auto names = ColumnNames(view);
+	auto view_name = QualifiedName(view);
+	string key_list;
+	for (auto &key : analysis.group_columns) {
+		if (!key_list.empty()) {
+			key_list += ", ";
+		}
+		key_list += QuoteName(names[key]);
+	}
+	auto keys = "(SELECT DISTINCT " + key_list + " FROM __mv_keys) AS __mv_keys";
+
+	auto statement =
+	    ParseStatement(context, "DELETE FROM " + view_name + " AS __mv_view USING " + keys + " WHERE " +
+	                                KeyCondition(names, analysis.group_columns, "__mv_view", "__mv_keys"));
+	ReplacePlaceholder(*statement, "__mv_keys", make_uniq<ColumnDataRef>(affected_groups, names));
+	execute(std::move(statement));
+
+	statement = ParseStatement(context, "INSERT INTO " + view_name + " SELECT __mv_query.* FROM __mv_query SEMI JOIN " +
+	                                        keys + " ON " +
+	                                        KeyCondition(names, analysis.group_columns, "__mv_query", "__mv_keys"));
+	ReplacePlaceholder(*statement, "__mv_keys", make_uniq<ColumnDataRef>(affected_groups, names));
+	ReplacePlaceholder(*statement, "__mv_query", ViewSubquery(view, GetViewQuery(view)));
+	execute(std::move(statement));
+}
+
+//! Propagates the changes incrementally, returns false if the view has to be recomputed instead
+static bool MaintainViewIncremental(ClientContext &context, TableCatalogEntry &view, MaterializedViewDelta &delta,
+                                    const maintenance_execute_t &execute) {
+	auto &table = delta.table;
+	auto analysis = AnalyzeView(context, *GetViewQuery(view), table);
+	if (!analysis.incremental) {
+		return false;
+	}
+	bool has_inserts = delta.inserted->Count() > 0;
+	bool has_deletes = delta.deleted->Count() > 0;
+	if (!analysis.aggregate) {
+		if (has_deletes) {
+			// without hidden row counts we cannot tell which rows of the view were produced by the deleted rows
+			return false;
+		}
+		if (has_inserts) {
+			InsertQuery(context, view, GetDeltaQuery(view, table, delta.inserted, false), execute);
+		}
+		return true;
+	}
+	if (analysis.mergeable && !has_deletes) {
+		if (has_inserts) {
+			MergeGroups(context, view, table, delta, analysis, execute);
+		}
+		return true;
+	}
+	if (analysis.group_columns.empty()) {
+		return false;
+	}
+	RecomputeGroups(context, view, table, delta, analysis, execute);
+	return true;
+}
+
+static void MaintainView(ClientContext &context, TableCatalogEntry &view, MaterializedViewDelta &delta,
+                         const maintenance_execute_t &execute) {
+	if (!delta.requires_refresh && !delta.table.HasGeneratedColumns()) {
+		try {
+			if (MaintainViewIncremental(context, view, delta, execute)) {
+				return;
+			}
+		} catch (std::exception &ex) {
+			ErrorData error(ex);
+			if (error.Type() != ExceptionType::BINDER) {
+				throw;
+			}
+			// the query over the changed rows could not be bound - recompute the view instead
+		}
+	}
+	RefreshView(context, view, execute);
+}
+
+void MaterializedViewMaintenance::Apply(ClientContext &context, const maintenance_execute_t &execute) {
+	auto previous_maintaining = maintaining;
+	maintaining = true;
+	try {
+		// maintaining a view modifies it - which can in turn affect views that read from it
+		while (true) {
+			vector<unique_ptr<MaterializedViewDelta>> changes;
+			{
+				lock_guard<mutex> guard(lock);
+				changes = std::move(deltas);
+				deltas.clear();
+			}
+			if (changes.empty()) {
+				break;
+			}
+			for (auto &delta : changes) {
+				for (auto &view : GetMaterializedViews(context, delta->table)) {
+					MaintainView(context, view.get(), *delta, execute);
+				}
+			}
+		}
+	} catch (...) {
+		maintaining = previous_maintaining;
+		Clear();
+		throw;
+	}
+	maintaining = previous_maintaining;
+}
+
+} // namespace duckdb
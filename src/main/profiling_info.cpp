@@ -37,6 +37,23 @@ profiler_settings_t ProfilingInfo::DefaultOperatorSettings() {
 	};
 }
 
+profiler_settings_t ProfilingInfo::ResourceSettings() {
+	return {
+	    MetricsType::OPERATOR_PEAK_MEMORY,        MetricsType::OPERATOR_TEMP_BYTES_WRITTEN,
+	    MetricsType::OPERATOR_TEMP_BYTES_READ,    MetricsType::OPERATOR_STORAGE_BYTES_READ,
+	    MetricsType::OPERATOR_BUFFER_HIT_RATIO,
+	};
+}
+
+profiler_settings_t ProfilingInfo::HardwareSettings() {
+	return {
+	    MetricsType::OPERATOR_CPU_CYCLES,
+	    MetricsType::OPERATOR_INSTRUCTIONS,
+	    MetricsType::OPERATOR_LLC_MISSES,
+	    MetricsType::OPERATOR_BRANCH_MISSES,
+	};
+}
+
 void ProfilingInfo::ResetSettings() {
 	settings.clear();
 	settings = DefaultSettings();
@@ -44,24 +61,41 @@ void ProfilingInfo::ResetSettings() {
 
 void ProfilingInfo::ResetMetrics() {
 	metrics.clear();
+	buffer_hits = 0;
+	buffer_misses = 0;
 
-	auto default_settings = DefaultSettings();
+	auto all_settings = DefaultSettings();
+	for (auto &metric : ResourceSettings()) {
+		all_settings.insert(metric);
+	}
+	for (auto &metric : HardwareSettings()) {
+		all_settings.insert(metric);
+	}
 
-	for (auto &metric : default_settings) {
+	for (auto &metric : all_settings) {
 		if (!Enabled(metric)) {
 			continue;
 		}
 
 		switch (metric) {
 		case MetricsType::CPU_TIME:
-		case MetricsType::OPERATOR_TIMING: {
+		case MetricsType::OPERATOR_TIMING:
+		case MetricsType::OPERATOR_BUFFER_HIT_RATIO: {
 			metrics[metric] = Value::CreateValue(0.0);
 			break;
 		}
 		case MetricsType::CUMULATIVE_CARDINALITY:
 		case MetricsType::OPERATOR_CARDINALITY:
 		case MetricsType::CUMULATIVE_ROWS_SCANNED:
-		case MetricsType::OPERATOR_ROWS_SCANNED: {
+		case MetricsType::OPERATOR_ROWS_SCANNED:
+		case MetricsType::OPERATOR_PEAK_MEMORY:
+		case MetricsType::OPERATOR_TEMP_BYTES_WRITTEN:
+		case MetricsType::OPERATOR_TEMP_BYTES_READ:
+		case MetricsType::OPERATOR_STORAGE_BYTES_READ:
+		case MetricsType::OPERATOR_CPU_CYCLES:
+		case MetricsType::OPERATOR_INSTRUCTIONS:
+		case MetricsType::OPERATOR_LLC_MISSES:
+		case MetricsType::OPERATOR_BRANCH_MISSES: {
 			metrics[metric] = Value::CreateValue<uint64_t>(0);
 			break;
 		}
@@ -90,6 +124,14 @@ bool ProfilingInfo::Enabled(const MetricsType setting) const {
 	return false;
 }
 
+void ProfilingInfo::AddBufferAccesses(idx_t hits, idx_t misses) {
+	buffer_hits += hits;
+	buffer_misses += misses;
+	auto total = buffer_hits + buffer_misses;
+	auto ratio = total == 0 ? 0.0 : static_cast<double>(buffer_hits) / static_cast<double>(total);
+	metrics[MetricsType::OPERATOR_BUFFER_HIT_RATIO] = Value::CreateValue(ratio);
+}
+
 string ProfilingInfo::GetMetricAsString(MetricsType setting) const {
 	if (!Enabled(setting)) {
 		throw InternalException("Metric %s not enabled", EnumUtil::ToString(setting));
@@ -144,14 +186,23 @@ void ProfilingInfo::WriteMetricsToJSON(yyjson_mut_doc *doc, yyjson_mut_val *dest
 
 		switch (metric) {
 		case MetricsType::CPU_TIME:
-		case MetricsType::OPERATOR_TIMING: {
+		case MetricsType::OPERATOR_TIMING:
+		case MetricsType::OPERATOR_BUFFER_HIT_RATIO: {
 			yyjson_mut_obj_add_real(doc, dest, key_ptr, metrics[metric].GetValue<double>());
 			break;
 		}
 		case MetricsType::CUMULATIVE_CARDINALITY:
 		case MetricsType::OPERATOR_CARDINALITY:
 		case MetricsType::CUMULATIVE_ROWS_SCANNED:
-		case MetricsType::OPERATOR_ROWS_SCANNED: {
+		case MetricsType::OPERATOR_ROWS_SCANNED:
+		case MetricsType::OPERATOR_PEAK_MEMORY:
+		case MetricsType::OPERATOR_TEMP_BYTES_WRITTEN:
+		case MetricsType::OPERATOR_TEMP_BYTES_READ:
+		case MetricsType::OPERATOR_STORAGE_BYTES_READ:
+		case MetricsType::OPERATOR_CPU_CYCLES:
+		case MetricsType::OPERATOR_INSTRUCTIONS:
+		case MetricsType::OPERATOR_LLC_MISSES:
+		case MetricsType::OPERATOR_BRANCH_MISSES: {
 			yyjson_mut_obj_add_uint(doc, dest, key_ptr, metrics[metric].GetValue<uint64_t>());
 			break;
 		}
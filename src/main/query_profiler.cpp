@@ -110,6 +110,7 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::COPY_TO_FILE:
 	case PhysicalOperatorType::TABLE_SCAN:
 	case PhysicalOperatorType::CHUNK_SCAN:
+	case PhysicalOperatorType::RESULT_CACHE_SCAN:
 	case PhysicalOperatorType::DELIM_SCAN:
 	case PhysicalOperatorType::EXPRESSION_SCAN:
 	case PhysicalOperatorType::BLOCKWISE_NL_JOIN:
@@ -118,6 +119,7 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::CROSS_PRODUCT:
 	case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
 	case PhysicalOperatorType::IE_JOIN:
+	case PhysicalOperatorType::INDEX_JOIN:
 	case PhysicalOperatorType::LEFT_DELIM_JOIN:
 	case PhysicalOperatorType::RIGHT_DELIM_JOIN:
 	case PhysicalOperatorType::UNION:
@@ -159,6 +161,30 @@ static void GetCumulativeMetric(ProfilingNode &node, MetricsType cumulative_metr
 	}
 }
 
+//! Sums the resource metrics of all operators in the tree
+static void SumResourceMetrics(ProfilingNode &node, ProfilingInfo &result) {
+	for (idx_t i = 0; i < node.GetChildCount(); i++) {
+		auto &child = *node.GetChild(i);
+		auto &info = child.GetProfilingInfo();
+		for (auto &metric : ProfilingInfo::ResourceSettings()) {
+			if (!result.Enabled(metric)) {
+				continue;
+			}
+			if (metric == MetricsType::OPERATOR_BUFFER_HIT_RATIO) {
+				result.AddBufferAccesses(info.buffer_hits, info.buffer_misses);
+			} else {
+				result.AddToMetric<idx_t>(metric, info.metrics[metric].GetValue<idx_t>());
+			}
+		}
+		for (auto &metric : ProfilingInfo::HardwareSettings()) {
+			if (result.Enabled(metric)) {
+				result.AddToMetric<idx_t>(metric, info.metrics[metric].GetValue<idx_t>());
+			}
+		}
+		SumResourceMetrics(child, result);
+	}
+}
+
 void QueryProfiler::EndQuery() {
 	lock_guard<mutex> guard(flush_lock);
 	if (!IsEnabled() || !running) {
@@ -178,6 +204,8 @@ void QueryProfiler::EndQuery() {
 			auto &query_info = root->Cast<QueryProfilingNode>();
 			query_info.query = query;
 			query_info.GetProfilingInfo() = ProfilingInfo(ClientConfig::GetConfig(context).profiler_settings);
+			// the resource metrics of the query are the totals over all operators
+			SumResourceMetrics(*root, query_info.GetProfilingInfo());
 			if (query_info.GetProfilingInfo().Enabled(MetricsType::OPERATOR_TIMING)) {
 				query_info.GetProfilingInfo().metrics[MetricsType::OPERATOR_TIMING] = main_query.Elapsed();
 			}
@@ -297,6 +325,40 @@ OperatorProfiler::OperatorProfiler(ClientContext &context) : context(context) {
 			operator_settings.insert(metric);
 		}
 	}
+	for (auto &metric : ProfilingInfo::ResourceSettings()) {
+		if (SettingIsEnabled(settings, metric)) {
+			operator_settings.insert(metric);
+			track_resources = true;
+		}
+	}
+	for (auto &metric : ProfilingInfo::HardwareSettings()) {
+		if (SettingIsEnabled(settings, metric)) {
+			operator_settings.insert(metric);
+			track_resources = true;
+			track_hardware_counters = true;
+		}
+	}
+}
+
+static idx_t CounterDelta(idx_t start, idx_t end) {
+	// hardware counters can fail to be read, in which case they are zero
+	return end >= start ? end - start : 0;
+}
+
+void OperatorInformation::AddResources(const ResourceCounterSnapshot &start, const ResourceCounterSnapshot &end,
+                                       int64_t peak) {
+	// the peak of this activation is relative to the memory that the operator had reserved before it
+	peak_memory = MaxValue<int64_t>(peak_memory, resources.memory_reserved + (peak - start.memory_reserved));
+	resources.memory_reserved += end.memory_reserved - start.memory_reserved;
+	resources.temp_bytes_written += CounterDelta(start.temp_bytes_written, end.temp_bytes_written);
+	resources.temp_bytes_read += CounterDelta(start.temp_bytes_read, end.temp_bytes_read);
+	resources.storage_bytes_read += CounterDelta(start.storage_bytes_read, end.storage_bytes_read);
+	resources.buffer_hits += CounterDelta(start.buffer_hits, end.buffer_hits);
+	resources.buffer_misses += CounterDelta(start.buffer_misses, end.buffer_misses);
+	resources.cpu_cycles += CounterDelta(start.cpu_cycles, end.cpu_cycles);
+	resources.instructions += CounterDelta(start.instructions, end.instructions);
+	resources.llc_misses += CounterDelta(start.llc_misses, end.llc_misses);
+	resources.branch_misses += CounterDelta(start.branch_misses, end.branch_misses);
 }
 
 void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_op) {
@@ -310,6 +372,11 @@ void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_o
 
 	active_operator = phys_op;
 
+	if (track_resources) {
+		ThreadResourceCounters::ResetPeakMemory();
+		start_resources = ThreadResourceCounters::Snapshot(track_hardware_counters);
+	}
+
 	// start timing for current element
 	if (HasOperatorSetting(MetricsType::OPERATOR_TIMING)) {
 		op.Start();
@@ -337,6 +404,10 @@ void OperatorProfiler::EndOperator(optional_ptr<DataChunk> chunk) {
 		if (HasOperatorSetting(MetricsType::OPERATOR_CARDINALITY) && chunk) {
 			curr_operator_info.AddReturnedElements(chunk->size());
 		}
+		if (track_resources) {
+			auto end_resources = ThreadResourceCounters::Snapshot(track_hardware_counters);
+			curr_operator_info.AddResources(start_resources, end_resources, ThreadResourceCounters::PeakMemory());
+		}
 	}
 	active_operator = nullptr;
 }
@@ -362,6 +433,38 @@ void OperatorProfiler::Flush(const PhysicalOperator &phys_op, ExpressionExecutor
 	operator_timing.name = phys_op.GetName();
 }
 
+static void AddResourceMetrics(const OperatorProfiler &profiler, ProfilingInfo &info, const OperatorInformation &op_info) {
+	auto &resources = op_info.resources;
+	if (profiler.HasOperatorSetting(MetricsType::OPERATOR_PEAK_MEMORY)) {
+		// threads execute the operator concurrently, so their peaks add up
+		info.AddToMetric<idx_t>(MetricsType::OPERATOR_PEAK_MEMORY, NumericCast<idx_t>(MaxValue<int64_t>(op_info.peak_memory, 0)));
+	}
+	if (profiler.HasOperatorSetting(MetricsType::OPERATOR_TEMP_BYTES_WRITTEN)) {
+		info.AddToMetric<idx_t>(MetricsType::OPERATOR_TEMP_BYTES_WRITTEN, resources.temp_bytes_written);
+	}
+	if (profiler.HasOperatorSetting(MetricsType::OPERATOR_TEMP_BYTES_READ)) {
+		info.AddToMetric<idx_t>(MetricsType::OPERATOR_TEMP_BYTES_READ, resources.temp_bytes_read);
+	}
+	if (profiler.HasOperatorSetting(MetricsType::OPERATOR_STORAGE_BYTES_READ)) {
+		info.AddToMetric<idx_t>(MetricsType::OPERATOR_STORAGE_BYTES_READ, resources.storage_bytes_read);
+	}
+	if (profiler.HasOperatorSetting(MetricsType::OPERATOR_BUFFER_HIT_RATIO)) {
+		info.AddBufferAccesses(resources.buffer_hits, resources.buffer_misses);
+	}
+	if (profiler.HasOperatorSetting(MetricsType::OPERATOR_CPU_CYCLES)) {
+		info.AddToMetric<idx_t>(MetricsType::OPERATOR_CPU_CYCLES, resources.cpu_cycles);
+	}
+	if (profiler.HasOperatorSetting(MetricsType::OPERATOR_INSTRUCTIONS)) {
+		info.AddToMetric<idx_t>(MetricsType::OPERATOR_INSTRUCTIONS, resources.instructions);
+	}
+	if (profiler.HasOperatorSetting(MetricsType::OPERATOR_LLC_MISSES)) {
+		info.AddToMetric<idx_t>(MetricsType::OPERATOR_LLC_MISSES, resources.llc_misses);
+	}
+	if (profiler.HasOperatorSetting(MetricsType::OPERATOR_BRANCH_MISSES)) {
+		info.AddToMetric<idx_t>(MetricsType::OPERATOR_BRANCH_MISSES, resources.branch_misses);
+	}
+}
+
 void QueryProfiler::Flush(OperatorProfiler &profiler) {
 	lock_guard<mutex> guard(flush_lock);
 	if (!IsEnabled() || !running) {
@@ -393,10 +496,27 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 				}
 			}
 		}
+		AddResourceMetrics(profiler, tree_node.GetProfilingInfo(), node.second);
 	}
 	profiler.timings.clear();
 }
 
+void QueryProfiler::AddOperatorInfo(const PhysicalOperator &op, const string &key, string value) {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running) {
+		return;
+	}
+	auto entry = tree_map.find(op);
+	if (entry == tree_map.end()) {
+		return;
+	}
+	auto &info = entry->second.get().GetProfilingInfo();
+	if (!info.Enabled(MetricsType::EXTRA_INFO)) {
+		return;
+	}
+	info.extra_info[key] = std::move(value);
+}
+
 string QueryProfiler::DrawPadded(const string &str, idx_t width) {
 	if (str.size() > width) {
 		return str.substr(0, width);
@@ -0,0 +1,118 @@
+#include "duckdb/main/query_result_cache.hpp"
+
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
+
+namespace duckdb {
+
+QueryResultCache::QueryResultCache(DatabaseInstance &db) : db(db) {
+}
+
+QueryResultCache::~QueryResultCache() {
+}
+
+QueryResultCache &QueryResultCache::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetQueryResultCache();
+}
+
+static bool DependenciesMatch(const vector<QueryResultCacheDependency> &cached,
+                              const vector<QueryResultCacheDependency> &current) {
+	if (cached.size() != current.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < cached.size(); i++) {
+		// the table must still exist - and must not have been changed since the result was computed
+		auto cached_table = cached[i].table.lock();
+		auto current_table = current[i].table.lock();
+		if (!cached_table || cached_table != current_table) {
+			return false;
+		}
+		if (cached[i].commit_version != current[i].commit_version ||
+		    cached_table->GetCommitVersion() != cached[i].commit_version) {
+			return false;
+		}
+	}
+	return true;
+}
+
+shared_ptr<ColumnDataCollection> QueryResultCache::Lookup(const string &key,
+                                                          const vector<QueryResultCacheDependency> &dependencies) {
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key);
+	if (entry == entries.end()) {
+		return nullptr;
+	}
+	if (!DependenciesMatch(entry->second.dependencies, dependencies)) {
+		// the result is stale
+		EraseEntry(entry);
+		return nullptr;
+	}
+	// move the entry to the front of the LRU list
+	lru.splice(lru.begin(), lru, entry->second.lru_position);
+	return entry->second.collection;
+}
+
+void QueryResultCache::Insert(const string &key, vector<QueryResultCacheDependency> dependencies,
+                              ColumnDataCollection &result) {
+	auto memory_limit = DBConfig::GetConfig(db).options.query_result_cache_limit;
+	// copy the result into a collection that is managed by the buffer manager
+	auto collection = make_shared_ptr<ColumnDataCollection>(BufferManager::GetBufferManager(db), result.Types());
+	ColumnDataAppendState append_state;
+	collection->InitializeAppend(append_state);
+	for (auto &chunk : result.Chunks()) {
+		collection->Append(append_state, chunk);
+	}
+	auto size = collection->AllocationSize();
+	if (size > memory_limit) {
+		return;
+	}
+
+	lock_guard<mutex> guard(lock);
+	auto entry = entries.find(key);
+	if (entry != entries.end()) {
+		EraseEntry(entry);
+	}
+	EvictEntries(memory_limit - size);
+
+	lru.push_front(key);
+	CachedResult cached_result;
+	cached_result.collection = std::move(collection);
+	cached_result.dependencies = std::move(dependencies);
+	cached_result.size = size;
+	cached_result.lru_position = lru.begin();
+	entries.insert(make_pair(key, std::move(cached_result)));
+	memory_usage += size;
+}
+
+void QueryResultCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	entries.clear();
+	lru.clear();
+	memory_usage = 0;
+}
+
+idx_t QueryResultCache::GetMemoryUsage() {
+	lock_guard<mutex> guard(lock);
+	return memory_usage;
+}
+
+void QueryResultCache::EraseEntry(unordered_map<string, CachedResult>::iterator entry) {
+	D_ASSERT(memory_usage >= entry->second.size);
+	memory_usage -= entry->second.size;
+	lru.erase(entry->second.lru_position);
+	entries.erase(entry);
+}
+
+void QueryResultCache::EvictEntries(idx_t memory_limit) {
+	while (memory_usage > memory_limit && !lru.empty()) {
+		auto entry = entries.find(lru.back());
+		D_ASSERT(entry != entries.end());
+		EraseEntry(entry);
+	}
+}
+
+} // namespace duckdb
@@ -9,6 +9,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
@@ -111,6 +112,74 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// WAL Commit Delay
+//===--------------------------------------------------------------------===//
+void WALCommitDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_commit_delay = input.GetValue<uint64_t>();
+}
+
+void WALCommitDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_commit_delay = DBConfig().options.wal_commit_delay;
+}
+
+Value WALCommitDelaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_commit_delay);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Async Commit
+//===--------------------------------------------------------------------===//
+void WALAsyncCommitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_async_commit = input.GetValue<bool>();
+}
+
+void WALAsyncCommitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_async_commit = DBConfig().options.wal_async_commit;
+}
+
+Value WALAsyncCommitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.wal_async_commit);
+}
+
+//===--------------------------------------------------------------------===//
+// Compaction Threshold
+//===--------------------------------------------------------------------===//
+void CompactionThresholdSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto threshold = input.GetValue<double>();
+	if (threshold < 0) {
+		throw InvalidInputException("compaction_threshold must be positive");
+	}
+	config.options.compaction_threshold = threshold;
+}
+
+void CompactionThresholdSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.compaction_threshold = DBConfig().options.compaction_threshold;
+}
+
+Value CompactionThresholdSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::DOUBLE(config.options.compaction_threshold);
+}
+
+//===--------------------------------------------------------------------===//
+// Compaction Row Limit
+//===--------------------------------------------------------------------===//
+void CompactionRowLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.compaction_row_limit = input.GetValue<uint64_t>();
+}
+
+void CompactionRowLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.compaction_row_limit = DBConfig().options.compaction_row_limit;
+}
+
+Value CompactionRowLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.compaction_row_limit);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -626,6 +695,44 @@ Value EnableObjectCacheSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.object_cache_enable);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Query Result Cache
+//===--------------------------------------------------------------------===//
+void EnableQueryResultCacheSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_query_result_cache = input.GetValue<bool>();
+	if (db && !config.options.enable_query_result_cache) {
+		db->GetQueryResultCache().Clear();
+	}
+}
+
+void EnableQueryResultCacheSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_query_result_cache = DBConfig().options.enable_query_result_cache;
+	if (db && !config.options.enable_query_result_cache) {
+		db->GetQueryResultCache().Clear();
+	}
+}
+
+Value EnableQueryResultCacheSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_query_result_cache);
+}
+
+//===--------------------------------------------------------------------===//
+// Query Result Cache Limit
+//===--------------------------------------------------------------------===//
+void QueryResultCacheLimitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.query_result_cache_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void QueryResultCacheLimitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.query_result_cache_limit = DBConfig().options.query_result_cache_limit;
+}
+
+Value QueryResultCacheLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.options.query_result_cache_limit));
+}
+
 //===--------------------------------------------------------------------===//
 // Storage Compatibility Version (for serialization)
 //===--------------------------------------------------------------------===//
@@ -841,6 +948,21 @@ Value AutoloadKnownExtensions::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.autoload_known_extensions);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Compiled Expressions
+//===--------------------------------------------------------------------===//
+void EnableCompiledExpressionsSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_compiled_expressions = ClientConfig().enable_compiled_expressions;
+}
+
+void EnableCompiledExpressionsSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_compiled_expressions = input.GetValue<bool>();
+}
+
+Value EnableCompiledExpressionsSetting::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_compiled_expressions);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable Progress Bar
 //===--------------------------------------------------------------------===//
@@ -1675,6 +1797,22 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.temp_file_compression = input.GetValue<bool>();
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.temp_file_compression);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -1703,6 +1841,30 @@ Value ThreadsSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(config.options.maximum_threads));
 }
 
+//===--------------------------------------------------------------------===//
+// Async I/O Threads
+//===--------------------------------------------------------------------===//
+void AsyncIOThreadsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto new_io_threads = input.GetValue<uint64_t>();
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetIOThreads(new_io_threads);
+	}
+	config.options.async_io_threads = new_io_threads;
+}
+
+void AsyncIOThreadsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	idx_t new_io_threads = DBConfig().options.async_io_threads;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetIOThreads(new_io_threads);
+	}
+	config.options.async_io_threads = new_io_threads;
+}
+
+Value AsyncIOThreadsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.async_io_threads);
+}
+
 //===--------------------------------------------------------------------===//
 // Username Setting
 //===--------------------------------------------------------------------===//
@@ -122,6 +122,8 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 		get.dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
 	}
 	pushdown_info->dynamic_filters = get.dynamic_filters;
+	// build Bloom filters over the build-side keys - these also prune probe-side rows whose key lies within [min, max]
+	pushdown_info->build_bloom_filters = true;
 
 	// set up the min/max aggregates for each of the filters
 	vector<AggregateFunction> aggr_functions;
@@ -0,0 +1,217 @@
+#include "duckdb/optimizer/late_materialization.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+
+namespace duckdb {
+
+LateMaterialization::LateMaterialization(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+unique_ptr<LogicalOperator> LateMaterialization::Optimize(unique_ptr<LogicalOperator> op) {
+	OptimizeInternal(op);
+	if (!replacement_bindings.empty()) {
+		// update the references to the late materialized columns
+		ColumnBindingReplacer replacer;
+		replacer.replacement_bindings = std::move(replacement_bindings);
+		replacer.VisitOperator(*op);
+	}
+	return op;
+}
+
+void LateMaterialization::OptimizeInternal(unique_ptr<LogicalOperator> &op) {
+	for (auto &child : op->children) {
+		OptimizeInternal(child);
+	}
+	if (op->type == LogicalOperatorType::LOGICAL_TOP_N) {
+		TryLateMaterialization(op);
+	}
+}
+
+static void InlineProjection(unique_ptr<Expression> &expr, LogicalProjection &projection) {
+	if (expr->type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr->Cast<BoundColumnRefExpression>();
+		if (colref.binding.table_index == projection.table_index) {
+			expr = projection.expressions[colref.binding.column_index]->Copy();
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(
+	    *expr, [&](unique_ptr<Expression> &child) { InlineProjection(child, projection); });
+}
+
+bool LateMaterialization::CanPushExpression(Expression &expr, idx_t table_index) {
+	if (expr.IsVolatile()) {
+		return false;
+	}
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_COLUMN_REF: {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		return colref.depth == 0 && colref.binding.table_index == table_index;
+	}
+	case ExpressionClass::BOUND_SUBQUERY:
+		return false;
+	default:
+		break;
+	}
+	bool can_push = true;
+	ExpressionIterator::EnumerateChildren(
+	    expr, [&](Expression &child) { can_push = can_push && CanPushExpression(child, table_index); });
+	return can_push;
+}
+
+static void GetKeyColumns(Expression &expr, vector<idx_t> &key_columns) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		auto column_index = expr.Cast<BoundColumnRefExpression>().binding.column_index;
+		if (std::find(key_columns.begin(), key_columns.end(), column_index) == key_columns.end()) {
+			key_columns.push_back(column_index);
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { GetKeyColumns(child, key_columns); });
+}
+
+static void ReplaceKeyColumns(Expression &expr, const vector<idx_t> &key_columns, idx_t table_index) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		auto entry = std::find(key_columns.begin(), key_columns.end(), colref.binding.column_index);
+		D_ASSERT(entry != key_columns.end());
+		colref.binding = ColumnBinding(table_index, NumericCast<idx_t>(entry - key_columns.begin()));
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(
+	    expr, [&](Expression &child) { ReplaceKeyColumns(child, key_columns, table_index); });
+}
+
+bool LateMaterialization::TryLateMaterialization(unique_ptr<LogicalOperator> &op) {
+	auto &top_n = op->Cast<LogicalTopN>();
+	if (top_n.limit > MAX_ROW_COUNT || top_n.offset > MAX_ROW_COUNT - top_n.limit) {
+		// fetching rows one-by-one is only beneficial for a small amount of rows
+		return false;
+	}
+	// find the table scan below the Top-N - looking through any projections
+	vector<reference<LogicalProjection>> projections;
+	reference<LogicalOperator> child = *top_n.children[0];
+	while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		auto &projection = child.get().Cast<LogicalProjection>();
+		for (auto &expr : projection.expressions) {
+			if (expr->IsVolatile()) {
+				return false;
+			}
+		}
+		projections.push_back(projection);
+		child = *projection.children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (get.function.name != "seq_scan" || !get.children.empty() || get.dynamic_filters) {
+		return false;
+	}
+	auto table = get.GetTable();
+	if (!table || !table->IsDuckTable()) {
+		return false;
+	}
+	auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan || bind_data.is_create_index) {
+		return false;
+	}
+
+	// rewrite the orders so they directly reference the columns of the table scan
+	vector<BoundOrderByNode> orders;
+	for (auto &order : top_n.orders) {
+		auto expr = order.expression->Copy();
+		for (auto &projection : projections) {
+			InlineProjection(expr, projection.get());
+		}
+		if (!CanPushExpression(*expr, get.table_index)) {
+			return false;
+		}
+		orders.emplace_back(order.type, order.null_order, std::move(expr));
+	}
+
+	// figure out which columns are required for the Top-N, and which columns we can fetch afterwards
+	auto &column_ids = get.GetColumnIds();
+	vector<idx_t> key_columns;
+	for (auto &order : orders) {
+		GetKeyColumns(*order.expression, key_columns);
+	}
+	auto bindings = get.GetColumnBindings();
+	bool has_payload = false;
+	for (auto &binding : bindings) {
+		if (std::find(key_columns.begin(), key_columns.end(), binding.column_index) == key_columns.end()) {
+			has_payload = true;
+		}
+	}
+	for (auto &key_column : key_columns) {
+		if (column_ids[key_column] == COLUMN_IDENTIFIER_ROW_ID) {
+			return false;
+		}
+	}
+	if (!has_payload) {
+		// all columns are required for the Top-N anyway
+		return false;
+	}
+
+	// the fetch operator emits all columns that were emitted by the table scan
+	vector<column_t> fetch_column_ids;
+	auto fetch_table_index = optimizer.binder.GenerateTableIndex();
+	for (idx_t i = 0; i < bindings.size(); i++) {
+		fetch_column_ids.push_back(column_ids[bindings[i].column_index]);
+		replacement_bindings.emplace_back(bindings[i], ColumnBinding(fetch_table_index, i));
+	}
+	auto fetch_bind_data = make_uniq<TableScanBindData>(table->Cast<DuckTableEntry>());
+	auto fetch = make_uniq<LogicalGet>(fetch_table_index, TableScanFunction::GetRowIdFetchFunction(),
+	                                   std::move(fetch_bind_data), get.returned_types, get.names);
+	fetch->SetColumnIds(std::move(fetch_column_ids));
+
+	// the table scan now only emits the key columns and the row ids (as the last column)
+	vector<column_t> scan_column_ids;
+	for (auto &key_column : key_columns) {
+		scan_column_ids.push_back(column_ids[key_column]);
+	}
+	scan_column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	auto projected_count = scan_column_ids.size();
+	for (auto &entry : get.table_filters.filters) {
+		// columns that are only used in filters are removed after the scan
+		if (std::find(scan_column_ids.begin(), scan_column_ids.end(), entry.first) == scan_column_ids.end()) {
+			scan_column_ids.push_back(entry.first);
+		}
+	}
+	get.projection_ids.clear();
+	if (scan_column_ids.size() > projected_count) {
+		for (idx_t i = 0; i < projected_count; i++) {
+			get.projection_ids.push_back(i);
+		}
+	}
+	get.table_index = optimizer.binder.GenerateTableIndex();
+	get.SetColumnIds(std::move(scan_column_ids));
+	for (auto &order : orders) {
+		ReplaceKeyColumns(*order.expression, key_columns, get.table_index);
+	}
+
+	// construct the new plan: PROJECTIONS -> FETCH -> TOP_N -> GET
+	auto &get_ptr = projections.empty() ? top_n.children[0] : projections.back().get().children[0];
+	auto new_top_n = make_uniq<LogicalTopN>(std::move(orders), top_n.limit, top_n.offset);
+	new_top_n->children.push_back(std::move(get_ptr));
+	fetch->children.push_back(std::move(new_top_n));
+	fetch->ResolveOperatorTypes();
+	if (projections.empty()) {
+		op = std::move(fetch);
+	} else {
+		get_ptr = std::move(fetch);
+		auto projection = std::move(top_n.children[0]);
+		op = std::move(projection);
+	}
+	return true;
+}
+
+} // namespace duckdb
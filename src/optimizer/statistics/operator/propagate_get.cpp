@@ -1,6 +1,7 @@
 #include "duckdb/optimizer/statistics_propagator.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
@@ -25,6 +26,23 @@ void StatisticsPropagator::UpdateFilterStatistics(BaseStatistics &input, TableFi
 		UpdateFilterStatistics(input, constant_filter.comparison_type, constant_filter.constant);
 		break;
 	}
+	case TableFilterType::IN_FILTER: {
+		// the values of the column are bounded by the smallest and the largest value in the IN list
+		auto &in_filter = filter.Cast<InFilter>();
+		auto min_value = in_filter.values[0];
+		auto max_value = in_filter.values[0];
+		for (auto &value : in_filter.values) {
+			if (value < min_value) {
+				min_value = value;
+			}
+			if (value > max_value) {
+				max_value = value;
+			}
+		}
+		UpdateFilterStatistics(input, ExpressionType::COMPARE_GREATERTHANOREQUALTO, min_value);
+		UpdateFilterStatistics(input, ExpressionType::COMPARE_LESSTHANOREQUALTO, max_value);
+		break;
+	}
 	default:
 		break;
 	}
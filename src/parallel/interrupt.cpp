@@ -38,6 +38,10 @@ void InterruptState::Callback() const {
 	}
 }
 
+bool InterruptState::CanBlock() const {
+	return mode != InterruptMode::NO_INTERRUPTS;
+}
+
 void InterruptDoneSignalState::Signal() {
 	{
 		unique_lock<mutex> lck {lock};
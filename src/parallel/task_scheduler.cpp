@@ -11,6 +11,8 @@
 #include "duckdb/common/thread.hpp"
 #include "lightweightsemaphore.h"
 
+#include <condition_variable>
+#include <deque>
 #include <thread>
 #else
 #include <queue>
@@ -43,6 +45,7 @@ struct ConcurrentQueue {
 	lightweight_semaphore_t semaphore;
 
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
+	void EnqueueBulk(ProducerToken &token, vector<shared_ptr<Task>> &tasks);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 };
 
@@ -62,6 +65,16 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	}
 }
 
+void ConcurrentQueue::EnqueueBulk(ProducerToken &token, vector<shared_ptr<Task>> &tasks) {
+	typedef std::make_signed<std::size_t>::type ssize_t;
+	lock_guard<mutex> producer_lock(token.producer_lock);
+	if (q.enqueue_bulk(token.token->queue_token, std::make_move_iterator(tasks.begin()), tasks.size())) {
+		semaphore.signal(NumericCast<ssize_t>(tasks.size()));
+	} else {
+		throw InternalException("Could not schedule tasks!");
+	}
+}
+
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
 	return q.try_dequeue_from_producer(token.token->queue_token, task);
@@ -73,6 +86,7 @@ struct ConcurrentQueue {
 	mutex qlock;
 
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
+	void EnqueueBulk(ProducerToken &token, vector<shared_ptr<Task>> &tasks);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 };
 
@@ -81,6 +95,13 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	q.push(std::move(task));
 }
 
+void ConcurrentQueue::EnqueueBulk(ProducerToken &token, vector<shared_ptr<Task>> &tasks) {
+	lock_guard<mutex> lock(qlock);
+	for (auto &task : tasks) {
+		q.push(std::move(task));
+	}
+}
+
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> lock(qlock);
 	if (q.empty()) {
@@ -97,6 +118,71 @@ struct QueueProducerToken {
 };
 #endif
 
+//! AsyncIOQueue holds the I/O operations that are performed by the I/O threads on behalf of blocked tasks
+struct AsyncIOQueue {
+	struct IORequest {
+		std::function<void()> io;
+		InterruptState interrupt_state;
+	};
+
+	mutex lock;
+	//! The requested amount of I/O threads
+	idx_t io_thread_count = 0;
+#ifndef DUCKDB_NO_THREADS
+	std::condition_variable cv;
+	std::deque<IORequest> requests;
+	//! The I/O threads, these are launched when the first I/O operation is scheduled
+	vector<unique_ptr<thread>> threads;
+	bool shutdown = false;
+
+	void StopThreads(unique_lock<mutex> &guard);
+#endif
+};
+
+#ifndef DUCKDB_NO_THREADS
+static void ThreadExecuteIO(AsyncIOQueue *queue) {
+	while (true) {
+		AsyncIOQueue::IORequest request;
+		{
+			unique_lock<mutex> guard(queue->lock);
+			queue->cv.wait(guard, [&]() { return queue->shutdown || !queue->requests.empty(); });
+			if (queue->requests.empty()) {
+				// we are shutting down and all outstanding I/O has been performed
+				return;
+			}
+			request = std::move(queue->requests.front());
+			queue->requests.pop_front();
+		}
+		try {
+			request.io();
+		} catch (...) {
+			// the I/O is a performance hint - any errors are thrown when the task performs the I/O itself
+		}
+		try {
+			request.interrupt_state.Callback();
+		} catch (...) {
+		}
+	}
+}
+
+void AsyncIOQueue::StopThreads(unique_lock<mutex> &guard) {
+	if (threads.empty()) {
+		return;
+	}
+	shutdown = true;
+	cv.notify_all();
+	auto stopped_threads = std::move(threads);
+	threads.clear();
+	// the threads finish the outstanding I/O before exiting
+	guard.unlock();
+	for (auto &io_thread : stopped_threads) {
+		io_thread->join();
+	}
+	guard.lock();
+	shutdown = false;
+}
+#endif
+
 ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
     : scheduler(scheduler), token(std::move(token)) {
 }
@@ -108,14 +194,16 @@ TaskScheduler::TaskScheduler(DatabaseInstance &db)
     : db(db), queue(make_uniq<ConcurrentQueue>()),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
-      current_thread_count(1) {
+      current_thread_count(1), io_queue(make_uniq<AsyncIOQueue>()) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
+	io_queue->io_thread_count = db.config.options.async_io_threads;
 }
 
 TaskScheduler::~TaskScheduler() {
 #ifndef DUCKDB_NO_THREADS
 	try {
 		RelaunchThreadsInternal(0);
+		SetIOThreads(0);
 	} catch (...) {
 		// nothing we can do in the destructor if this fails
 	}
@@ -140,6 +228,14 @@ void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
 	queue->Enqueue(token, std::move(task));
 }
 
+void TaskScheduler::ScheduleTasks(ProducerToken &token, vector<shared_ptr<Task>> &tasks) {
+	if (tasks.empty()) {
+		return;
+	}
+	// Enqueue all tasks at once - this only acquires the producer lock and signals the semaphore a single time
+	queue->EnqueueBulk(token, tasks);
+}
+
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	return queue->DequeueFromProducer(token, task);
 }
@@ -149,6 +245,9 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 	static constexpr const int64_t INITIAL_FLUSH_WAIT = 500000; // initial wait time of 0.5s (in mus) before flushing
 
 	shared_ptr<Task> task;
+	// the consumer token makes this thread keep dequeuing from the same producer (i.e. the same executor) while it has
+	// tasks available, which reduces contention on the queue and keeps the tasks of a pipeline on the same thread
+	duckdb_moodycamel::ConsumerToken consumer_token(queue->q);
 	// loop until the marker is set to false
 	while (*marker) {
 		if (!Allocator::SupportsFlush() || allocator_background_threads) {
@@ -164,7 +263,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				queue->semaphore.wait();
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (queue->q.try_dequeue(consumer_token, task)) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -194,10 +293,11 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	idx_t completed_tasks = 0;
+	duckdb_moodycamel::ConsumerToken consumer_token(queue->q);
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->q.try_dequeue(consumer_token, task)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -225,9 +325,10 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
 	shared_ptr<Task> task;
+	duckdb_moodycamel::ConsumerToken consumer_token(queue->q);
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->q.try_dequeue(consumer_token, task)) {
 			return;
 		}
 		try {
@@ -280,6 +381,47 @@ void TaskScheduler::SetThreads(idx_t total_threads, idx_t external_threads) {
 	requested_thread_count = NumericCast<int32_t>(total_threads - external_threads);
 }
 
+bool TaskScheduler::ScheduleIO(std::function<void()> io, const InterruptState &interrupt_state) {
+#ifndef DUCKDB_NO_THREADS
+	if (!interrupt_state.CanBlock()) {
+		return false;
+	}
+	lock_guard<mutex> guard(io_queue->lock);
+	if (io_queue->shutdown) {
+		// the I/O threads are being stopped
+		return false;
+	}
+	// launch the I/O threads if they have not been launched yet
+	while (io_queue->threads.size() < io_queue->io_thread_count) {
+		try {
+			io_queue->threads.push_back(make_uniq<thread>(ThreadExecuteIO, io_queue.get()));
+		} catch (std::exception &ex) {
+			// thread constructor failed - continue with the threads we have
+			break;
+		}
+	}
+	if (io_queue->threads.empty()) {
+		return false;
+	}
+	io_queue->requests.push_back(AsyncIOQueue::IORequest {std::move(io), interrupt_state});
+	io_queue->cv.notify_one();
+	return true;
+#else
+	return false;
+#endif
+}
+
+void TaskScheduler::SetIOThreads(idx_t io_threads) {
+	unique_lock<mutex> guard(io_queue->lock);
+	io_queue->io_thread_count = io_threads;
+#ifndef DUCKDB_NO_THREADS
+	if (io_queue->threads.size() > io_threads) {
+		// stop all threads - the remaining threads are launched again when the next I/O operation is scheduled
+		io_queue->StopThreads(guard);
+	}
+#endif
+}
+
 void TaskScheduler::SetAllocatorFlushTreshold(idx_t threshold) {
 	allocator_flush_threshold = threshold;
 }
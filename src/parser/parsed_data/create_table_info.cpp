@@ -26,11 +26,31 @@ unique_ptr<CreateInfo> CreateTableInfo::Copy() const {
 	if (query) {
 		result->query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
 	}
+	if (materialized_view_query) {
+		result->materialized_view_query =
+		    unique_ptr_cast<SQLStatement, SelectStatement>(materialized_view_query->Copy());
+	}
 	return std::move(result);
 }
 
 string CreateTableInfo::ToString() const {
 	string ret = "";
+	if (materialized_view_query) {
+		ret += "CREATE";
+		if (on_conflict == OnCreateConflict::REPLACE_ON_CONFLICT) {
+			ret += " OR REPLACE";
+		}
+		if (temporary) {
+			ret += " TEMPORARY";
+		}
+		ret += " VIEW ";
+		if (on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT) {
+			ret += " IF NOT EXISTS ";
+		}
+		ret += QualifierToString(temporary ? "" : catalog, schema, table);
+		ret += " WITH (materialized) AS " + materialized_view_query->ToString() + ";";
+		return ret;
+	}
 
 	ret += "CREATE";
 	if (on_conflict == OnCreateConflict::REPLACE_ON_CONFLICT) {
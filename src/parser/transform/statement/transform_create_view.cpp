@@ -1,6 +1,8 @@
 #include "duckdb/parser/statement/create_statement.hpp"
 #include "duckdb/parser/transformer.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
+#include "duckdb/parser/parsed_data/create_table_info.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
 
 namespace duckdb {
 
@@ -42,15 +44,46 @@ unique_ptr<CreateStatement> Transformer::TransformCreateView(duckdb_libpgquery::
 		}
 	}
 
-	if (stmt.options && stmt.options->length > 0) {
-		throw NotImplementedException("VIEW options");
+	bool materialized = false;
+	if (stmt.options) {
+		duckdb_libpgquery::PGListCell *cell;
+		for_each_cell(cell, stmt.options->head) {
+			auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(cell->data.ptr_value);
+			if (!StringUtil::CIEquals(def_elem->defname, "materialized")) {
+				throw NotImplementedException("VIEW options");
+			}
+			Value val = Value::BOOLEAN(true);
+			if (def_elem->arg) {
+				val = TransformValue(*PGPointerCast<duckdb_libpgquery::PGValue>(def_elem->arg))->value;
+			}
+			materialized = BooleanValue::Get(val.DefaultCastAs(LogicalType::BOOLEAN));
+		}
 	}
 
 	if (stmt.withCheckOption != duckdb_libpgquery::PGViewCheckOption::PG_NO_CHECK_OPTION) {
 		throw NotImplementedException("VIEW CHECK options");
 	}
+	if (materialized) {
+		result->info = TransformMaterializedView(*info);
+		return result;
+	}
 	result->info = std::move(info);
 	return result;
 }
 
+unique_ptr<CreateInfo> Transformer::TransformMaterializedView(CreateViewInfo &view_info) {
+	// a materialized view is stored as a table that holds the result of the query, the query is kept around so the
+	// table can be maintained when the tables it reads from are changed
+	if (!view_info.aliases.empty()) {
+		throw NotImplementedException("Column aliases for materialized views are not supported, use aliases in the "
+		                              "SELECT list instead");
+	}
+	auto info = make_uniq<CreateTableInfo>(view_info.catalog, view_info.schema, view_info.view_name);
+	info->temporary = view_info.temporary;
+	info->on_conflict = view_info.on_conflict;
+	info->query = unique_ptr_cast<SQLStatement, SelectStatement>(view_info.query->Copy());
+	info->materialized_view_query = std::move(view_info.query);
+	return std::move(info);
+}
+
 } // namespace duckdb
@@ -12,6 +12,8 @@ unique_ptr<SQLStatement> Transformer::TransformDrop(duckdb_libpgquery::PGDropStm
 	}
 	switch (stmt.removeType) {
 	case duckdb_libpgquery::PG_OBJECT_TABLE:
+	case duckdb_libpgquery::PG_OBJECT_MATVIEW:
+		// materialized views are stored as tables
 		info.type = CatalogType::TABLE_ENTRY;
 		break;
 	case duckdb_libpgquery::PG_OBJECT_SCHEMA:
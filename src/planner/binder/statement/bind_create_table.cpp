@@ -20,6 +20,10 @@
 #include "duckdb/planner/expression_binder/index_binder.hpp"
 #include "duckdb/parser/parsed_data/create_index_info.hpp"
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/materialized_view_maintenance.hpp"
+#include "duckdb/parser/query_node/list.hpp"
+#include "duckdb/parser/tableref/basetableref.hpp"
 
 #include <algorithm>
 
@@ -288,6 +292,104 @@ static void ExtractDependencies(BoundCreateTableInfo &info, vector<unique_ptr<Ex
 	}
 }
 
+static void VerifyMaterializedViewColumns(QueryNode &node, const string &view_name) {
+	switch (node.type) {
+	case QueryNodeType::SELECT_NODE:
+		for (auto &expr : node.Cast<SelectNode>().select_list) {
+			if (expr->GetExpressionClass() == ExpressionClass::STAR) {
+				// the columns of a star expression change when columns are added to the tables
+				throw BinderException("Materialized view \"%s\" cannot use * in its SELECT list, list the columns instead",
+				                      view_name);
+			}
+		}
+		break;
+	case QueryNodeType::SET_OPERATION_NODE: {
+		auto &setop = node.Cast<SetOperationNode>();
+		VerifyMaterializedViewColumns(*setop.left, view_name);
+		VerifyMaterializedViewColumns(*setop.right, view_name);
+		break;
+	}
+	case QueryNodeType::CTE_NODE:
+		VerifyMaterializedViewColumns(*node.Cast<CTENode>().child, view_name);
+		break;
+	default:
+		break;
+	}
+}
+
+//! Resolves the tables that are read by a materialized view, and adds them to the dependencies of the view
+static void BindMaterializedView(ClientContext &context, BoundCreateTableInfo &info) {
+	auto &base = info.Base();
+	auto &catalog = info.schema.ParentCatalog();
+	if (!catalog.IsDuckCatalog()) {
+		throw BinderException("Materialized views can only be created in DuckDB databases");
+	}
+	auto &node = *base.materialized_view_query->node;
+	VerifyMaterializedViewColumns(node, base.table);
+
+	case_insensitive_set_t cte_names;
+	auto node_callback = [&](QueryNode &child) {
+		for (auto &cte : child.cte_map.map) {
+			cte_names.insert(cte.first);
+		}
+	};
+	MaterializedViewMaintenance::EnumerateTableRefs(
+	    node,
+	    [&](unique_ptr<TableRef> &ref) {
+		    if (ref->type == TableReferenceType::TABLE_FUNCTION) {
+			    throw BinderException("Materialized view \"%s\" cannot read from table functions", base.table);
+		    }
+		    if (ref->type != TableReferenceType::BASE_TABLE) {
+			    return;
+		    }
+		    auto &table_ref = ref->Cast<BaseTableRef>();
+		    if (table_ref.catalog_name.empty() && table_ref.schema_name.empty() &&
+		        cte_names.find(table_ref.table_name) != cte_names.end()) {
+			    return;
+		    }
+		    auto &entry = Catalog::GetEntry(context, CatalogType::TABLE_ENTRY, table_ref.catalog_name,
+		                                    table_ref.schema_name, table_ref.table_name);
+		    if (entry.type != CatalogType::TABLE_ENTRY) {
+			    throw BinderException("Materialized view \"%s\" can only read from tables, \"%s\" is not a table",
+			                          base.table, table_ref.table_name);
+		    }
+		    if (&entry.ParentCatalog() != &catalog) {
+			    throw BinderException("Materialized view \"%s\" can only read from tables in the same database",
+			                          base.table);
+		    }
+		    // the view is maintained by re-running (parts of) the query - refer to the tables by their full name
+		    auto &table = entry.Cast<TableCatalogEntry>();
+		    table_ref.catalog_name = string();
+		    table_ref.schema_name = table.schema.name;
+		    table_ref.table_name = table.name;
+		    base.dependencies.AddDependency(table);
+	    },
+	    node_callback);
+
+	// the table is filled with the result of the query
+	base.query = unique_ptr_cast<SQLStatement, SelectStatement>(base.materialized_view_query->Copy());
+	MaterializedViewMaintenance::EnumerateTableRefs(*base.query->node, [&](unique_ptr<TableRef> &ref) {
+		if (ref->type != TableReferenceType::BASE_TABLE) {
+			return;
+		}
+		auto &table_ref = ref->Cast<BaseTableRef>();
+		if (!table_ref.schema_name.empty()) {
+			table_ref.catalog_name = catalog.GetName();
+		}
+	});
+}
+
+//! A materialized view depends on the tables it reads from
+static void AddMaterializedViewDependencies(BoundCreateTableInfo &info) {
+	auto &base = info.Base();
+	if (!base.materialized_view_query) {
+		return;
+	}
+	for (auto &dependency : base.dependencies.Set()) {
+		info.dependencies.AddDependency(dependency);
+	}
+}
+
 unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateInfo> info, SchemaCatalogEntry &schema) {
 	vector<unique_ptr<Expression>> bound_defaults;
 	return BindCreateTableInfo(std::move(info), schema, bound_defaults);
@@ -297,6 +399,7 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableCheckpoint(unique_ptr<Cr
                                                                    SchemaCatalogEntry &schema) {
 	auto result = make_uniq<BoundCreateTableInfo>(schema, std::move(info));
 	CreateColumnDependencyManager(*result);
+	AddMaterializedViewDependencies(*result);
 	return result;
 }
 
@@ -307,6 +410,10 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 	auto &dependencies = result->dependencies;
 
 	vector<unique_ptr<BoundConstraint>> bound_constraints;
+	if (base.materialized_view_query && base.query) {
+		// creating a materialized view
+		BindMaterializedView(context, *result);
+	}
 	if (base.query) {
 		// construct the result object
 		auto query_obj = Bind(*base.query);
@@ -339,6 +446,7 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 	}
 	// extract dependencies from any default values or CHECK constraints
 	ExtractDependencies(*result, bound_defaults, bound_constraints);
+	AddMaterializedViewDependencies(*result);
 
 	if (base.columns.PhysicalColumnCount() == 0) {
 		throw BinderException("Creating a table without physical (non-generated) columns is not supported");
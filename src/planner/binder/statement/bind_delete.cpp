@@ -9,6 +9,7 @@
 #include "duckdb/planner/tableref/bound_basetableref.hpp"
 #include "duckdb/planner/operator/logical_cross_product.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/materialized_view_maintenance.hpp"
 
 namespace duckdb {
 
@@ -22,6 +23,7 @@ BoundStatement Binder::Bind(DeleteStatement &stmt) {
 	}
 	auto &table_binding = bound_table->Cast<BoundBaseTableRef>();
 	auto &table = table_binding.table;
+	MaterializedViewMaintenance::VerifyModification(context, table);
 
 	auto root = CreatePlan(*bound_table);
 	auto &get = root->Cast<LogicalGet>();
@@ -97,7 +97,15 @@ void ScanForeignKeyTable(catalog_entry_vector_t &ordered, catalog_entry_vector_t
 
 void ReorderTableEntries(catalog_entry_vector_t &tables) {
 	catalog_entry_vector_t ordered;
-	catalog_entry_vector_t unordered = tables;
+	catalog_entry_vector_t unordered;
+	catalog_entry_vector_t materialized_views;
+	for (auto &entry : tables) {
+		if (entry.get().Cast<TableCatalogEntry>().IsMaterializedView()) {
+			materialized_views.push_back(entry);
+		} else {
+			unordered.push_back(entry);
+		}
+	}
 	// First only move the tables that don't have any dependencies
 	ScanForeignKeyTable(ordered, unordered, true);
 	while (!unordered.empty()) {
@@ -105,6 +113,14 @@ void ReorderTableEntries(catalog_entry_vector_t &tables) {
 		// if the tables they reference are already moved
 		ScanForeignKeyTable(ordered, unordered, false);
 	}
+	// Materialized views come after the tables they read from - which were created before them
+	sort(materialized_views.begin(), materialized_views.end(),
+	     [](const reference<CatalogEntry> &lhs, const reference<CatalogEntry> &rhs) {
+		     return lhs.get().oid < rhs.get().oid;
+	     });
+	for (auto &entry : materialized_views) {
+		ordered.push_back(entry);
+	}
 	tables = ordered;
 }
 
@@ -226,6 +242,10 @@ BoundStatement Binder::Bind(ExportStatement &stmt) {
 		ExportedTableInfo table_info(table, std::move(exported_data), not_null_columns);
 		exported_tables.data.push_back(table_info);
 		id++;
+		if (table.IsMaterializedView()) {
+			// the contents of a materialized view are recomputed when it is created again
+			continue;
+		}
 
 		// generate the copy statement and bind it
 		CopyStatement copy_stmt;
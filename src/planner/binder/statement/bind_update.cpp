@@ -15,6 +15,7 @@
 #include "duckdb/planner/tableref/bound_basetableref.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/main/materialized_view_maintenance.hpp"
 
 #include <algorithm>
 
@@ -76,6 +77,7 @@ BoundStatement Binder::Bind(UpdateStatement &stmt) {
 	}
 	auto &table_binding = bound_table->Cast<BoundBaseTableRef>();
 	auto &table = table_binding.table;
+	MaterializedViewMaintenance::VerifyModification(context, table);
 
 	// Add CTEs as bindable
 	AddCTEMap(stmt.cte_map);
@@ -0,0 +1,109 @@
+#include "duckdb/planner/filter/bloom_table_filter.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+BloomTableFilter::BloomTableFilter(shared_ptr<BloomFilter> filter_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), filter(std::move(filter_p)), probed_count(0), passed_count(0),
+      disabled(false) {
+}
+
+idx_t BloomTableFilter::Filter(Vector &vector, UnifiedVectorFormat &vdata, SelectionVector &sel,
+                               idx_t &approved_tuple_count, idx_t count) const {
+	if (approved_tuple_count == 0 || disabled) {
+		return approved_tuple_count;
+	}
+	Vector hashes(LogicalType::HASH, count);
+	VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+	hashes.Flatten(count);
+
+	SelectionVector result_sel(approved_tuple_count);
+	auto result_count = filter->Probe(hashes, sel, approved_tuple_count, result_sel);
+	if (!vdata.validity.AllValid()) {
+		// NULL values never find a join partner - remove them
+		idx_t valid_count = 0;
+		for (idx_t i = 0; i < result_count; i++) {
+			auto idx = result_sel.get_index(i);
+			if (vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+				result_sel.set_index(valid_count++, idx);
+			}
+		}
+		result_count = valid_count;
+	}
+
+	// keep track of the selectivity - if (almost) every row passes the filter it is not worth evaluating
+	auto total_probed = probed_count.fetch_add(approved_tuple_count) + approved_tuple_count;
+	auto total_passed = passed_count.fetch_add(result_count) + result_count;
+	if (total_probed >= ADAPTIVE_PROBE_COUNT &&
+	    double(total_passed) > ADAPTIVE_PASS_THRESHOLD * double(total_probed)) {
+		disabled = true;
+	}
+
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+	return approved_tuple_count;
+}
+
+FilterPropagateResult BloomTableFilter::CheckStatistics(BaseStatistics &stats) {
+	switch (stats.GetType().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE: {
+		if (!NumericStats::HasMinMax(stats)) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		auto min_value = NumericStats::Min(stats);
+		if (min_value != NumericStats::Max(stats)) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		// the segment contains a single (non-NULL) value - we can check if it is in the filter
+		if (!filter->Contains(min_value.Hash())) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+string BloomTableFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER";
+}
+
+bool BloomTableFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomTableFilter>();
+	return other.filter.get() == filter.get();
+}
+
+unique_ptr<TableFilter> BloomTableFilter::Copy() const {
+	// the Bloom filter is immutable - the copy can share it
+	return make_uniq<BloomTableFilter>(filter);
+}
+
+unique_ptr<Expression> BloomTableFilter::ToExpression(const Expression &column) const {
+	// the Bloom filter only removes rows that are guaranteed to be eliminated by the join
+	// as such we can always safely replace it with "true"
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+void BloomTableFilter::Serialize(Serializer &serializer) const {
+	throw SerializationException("BloomTableFilter is a runtime filter and cannot be serialized");
+}
+
+} // namespace duckdb
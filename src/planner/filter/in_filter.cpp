@@ -0,0 +1,94 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+InFilter::InFilter(vector<Value> values_p) : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)) {
+	if (values.empty()) {
+		throw InternalException("InFilter requires at least one value");
+	}
+	for (auto &value : values) {
+		if (value.IsNull()) {
+			throw InternalException("InFilter values cannot be NULL");
+		}
+		if (value.type() != values[0].type()) {
+			throw InternalException("InFilter values must all have the same type");
+		}
+	}
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	// check every value as if it were an equality filter
+	// if all of them are always false - the IN filter is always false
+	// if any of them is always true - the IN filter is always true
+	bool always_false = true;
+	for (auto &value : values) {
+		D_ASSERT(value.type().id() == stats.GetType().id());
+		FilterPropagateResult prune_result;
+		switch (value.type().InternalType()) {
+		case PhysicalType::UINT8:
+		case PhysicalType::UINT16:
+		case PhysicalType::UINT32:
+		case PhysicalType::UINT64:
+		case PhysicalType::UINT128:
+		case PhysicalType::INT8:
+		case PhysicalType::INT16:
+		case PhysicalType::INT32:
+		case PhysicalType::INT64:
+		case PhysicalType::INT128:
+		case PhysicalType::FLOAT:
+		case PhysicalType::DOUBLE:
+			prune_result = NumericStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, value);
+			break;
+		case PhysicalType::VARCHAR:
+			prune_result = StringStats::CheckZonemap(stats, ExpressionType::COMPARE_EQUAL, StringValue::Get(value));
+			break;
+		default:
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		if (prune_result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+			return FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		}
+		if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			always_false = false;
+		}
+	}
+	return always_false ? FilterPropagateResult::FILTER_ALWAYS_FALSE : FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string InFilter::ToString(const string &column_name) {
+	string in_list;
+	for (auto &value : values) {
+		if (!in_list.empty()) {
+			in_list += ", ";
+		}
+		in_list += value.ToSQLString();
+	}
+	return column_name + " IN (" + in_list + ")";
+}
+
+unique_ptr<Expression> InFilter::ToExpression(const Expression &column) const {
+	auto result = make_uniq<BoundOperatorExpression>(ExpressionType::COMPARE_IN, LogicalType::BOOLEAN);
+	result->children.push_back(column.Copy());
+	for (auto &value : values) {
+		result->children.push_back(make_uniq<BoundConstantExpression>(value));
+	}
+	return std::move(result);
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+} // namespace duckdb
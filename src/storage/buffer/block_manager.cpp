@@ -81,6 +81,12 @@ void BlockManager::UnregisterBlock(block_id_t block_id, bool can_destroy) {
 	}
 }
 
+void BlockManager::ReadBlocks(const vector<BlockReadRun> &runs) {
+	for (auto &run : runs) {
+		ReadBlocks(run.buffer.get(), run.start_block, run.block_count);
+	}
+}
+
 MetadataManager &BlockManager::GetMetadataManager() {
 	return *metadata_manager;
 }
@@ -2,6 +2,7 @@
 
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/resource_counters.hpp"
 #include "duckdb/common/typedefs.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -408,6 +409,7 @@ BufferPool::MemoryUsage::MemoryUsage() {
 }
 
 void BufferPool::MemoryUsage::UpdateUsedMemory(MemoryTag tag, int64_t size) {
+	ThreadResourceCounters::AddMemoryReserved(size);
 	auto tag_idx = (idx_t)tag;
 	if ((idx_t)AbsValue(size) < MEMORY_USAGE_CACHE_THRESHOLD) {
 		// update cache and update global counter when cache exceeds threshold
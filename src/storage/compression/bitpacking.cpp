@@ -11,6 +11,7 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/compression/bitpacking.hpp"
+#include "duckdb/storage/compression/compressed_filter.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -881,6 +882,132 @@ void BitpackingScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_c
 	BitpackingScanPartial<T>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T, class T_U = typename MakeUnsigned<T>::type>
+bool BitpackingFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                      SelectionVector &sel, idx_t &sel_count, const TableFilter &filter) {
+	CompressedFilter<T> compressed_filter;
+	if (!compressed_filter.Initialize(filter)) {
+		return false;
+	}
+	auto &scan_state = state.scan_state->Cast<BitpackingScanState<T>>();
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	//! Because FOR offsets all our values to be 0 or above, we can always skip sign extension here
+	bool skip_sign_extend = true;
+
+	SelectionVector result_sel(sel_count);
+	idx_t result_count = 0;
+	idx_t sel_idx = 0;
+	vector<pair<ExpressionType, T_U>> code_comparisons;
+	idx_t scanned = 0;
+	while (scanned < vector_count) {
+		if (scan_state.current_group_offset == BITPACKING_METADATA_GROUP_SIZE) {
+			scan_state.LoadNextGroup();
+		}
+		idx_t to_scan;
+		switch (scan_state.current_group.mode) {
+		case BitpackingMode::CONSTANT: {
+			// evaluate the filter once for the entire group
+			to_scan = MinValue<idx_t>(vector_count - scanned,
+			                          BITPACKING_METADATA_GROUP_SIZE - scan_state.current_group_offset);
+			auto matches = compressed_filter.Matches(scan_state.current_constant);
+			for (; sel_idx < sel_count && sel.get_index(sel_idx) < scanned + to_scan; sel_idx++) {
+				if (matches) {
+					auto idx = sel.get_index(sel_idx);
+					result_data[idx] = scan_state.current_constant;
+					result_sel.set_index(result_count++, idx);
+				}
+			}
+			scan_state.current_group_offset += to_scan;
+			break;
+		}
+		case BitpackingMode::FOR: {
+			idx_t offset_in_compression_group =
+			    scan_state.current_group_offset % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+			to_scan = MinValue<idx_t>(vector_count - scanned, BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE -
+			                                                      offset_in_compression_group);
+			if (sel_idx >= sel_count || sel.get_index(sel_idx) >= scanned + to_scan) {
+				// no rows of this algorithm group are selected
+				scan_state.current_group_offset += to_scan;
+				break;
+			}
+			// translate the constants into code space: all values are >= the frame of reference, so the comparison of
+			// (code + frame of reference) with the constant is either constant, or a comparison of the code with
+			// (constant - frame of reference)
+			auto frame_of_reference = scan_state.current_frame_of_reference;
+			bool can_match = true;
+			code_comparisons.clear();
+			for (auto &comparison : compressed_filter.comparisons) {
+				if (comparison.second >= frame_of_reference) {
+					auto code_constant = static_cast<T_U>(static_cast<T_U>(comparison.second) -
+					                                      static_cast<T_U>(frame_of_reference));
+					code_comparisons.emplace_back(comparison.first, code_constant);
+					continue;
+				}
+				switch (comparison.first) {
+				case ExpressionType::COMPARE_NOTEQUAL:
+				case ExpressionType::COMPARE_GREATERTHAN:
+				case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+					break;
+				default:
+					can_match = false;
+					break;
+				}
+			}
+			if (!can_match) {
+				while (sel_idx < sel_count && sel.get_index(sel_idx) < scanned + to_scan) {
+					sel_idx++;
+				}
+				scan_state.current_group_offset += to_scan;
+				break;
+			}
+
+			data_ptr_t decompression_group_start_pointer =
+			    scan_state.current_group_ptr +
+			    (scan_state.current_group_offset - offset_in_compression_group) * scan_state.current_width / 8;
+			BitpackingPrimitives::UnPackBlock<T>(data_ptr_cast(scan_state.decompression_buffer),
+			                                     decompression_group_start_pointer, scan_state.current_width,
+			                                     skip_sign_extend);
+			auto codes = reinterpret_cast<T_U *>(scan_state.decompression_buffer) + offset_in_compression_group;
+			for (; sel_idx < sel_count && sel.get_index(sel_idx) < scanned + to_scan; sel_idx++) {
+				auto idx = sel.get_index(sel_idx);
+				auto code = codes[idx - scanned];
+				bool matches = true;
+				for (auto &comparison : code_comparisons) {
+					matches = matches && CompressedFilter<T_U>::Compare(comparison.first, code, comparison.second);
+				}
+				result_data[idx] = static_cast<T>(code + static_cast<T_U>(frame_of_reference));
+				result_sel.set_index(result_count, idx);
+				result_count += matches;
+			}
+			scan_state.current_group_offset += to_scan;
+			break;
+		}
+		default: {
+			// delta encoded groups have to be decoded before the filter can be evaluated
+			to_scan = MinValue<idx_t>(vector_count - scanned,
+			                          BITPACKING_METADATA_GROUP_SIZE - scan_state.current_group_offset);
+			BitpackingScanPartial<T>(segment, state, to_scan, result, scanned);
+			for (; sel_idx < sel_count && sel.get_index(sel_idx) < scanned + to_scan; sel_idx++) {
+				auto idx = sel.get_index(sel_idx);
+				result_sel.set_index(result_count, idx);
+				result_count += compressed_filter.Matches(result_data[idx]);
+			}
+			break;
+		}
+		}
+		scanned += to_scan;
+	}
+	sel.Initialize(result_sel);
+	sel_count = result_count;
+	return true;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -950,13 +1077,30 @@ void BitpackingSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_c
 //===--------------------------------------------------------------------===//
 // Get Function
 //===--------------------------------------------------------------------===//
+template <class T>
+compression_filter_t GetBitpackingFilter() {
+	return BitpackingFilter<T>;
+}
+
+template <>
+compression_filter_t GetBitpackingFilter<hugeint_t>() {
+	return nullptr;
+}
+
+template <>
+compression_filter_t GetBitpackingFilter<uhugeint_t>() {
+	return nullptr;
+}
+
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetBitpackingFunction(PhysicalType data_type) {
 	return CompressionFunction(CompressionType::COMPRESSION_BITPACKING, data_type, BitpackingInitAnalyze<T>,
 	                           BitpackingAnalyze<T>, BitpackingFinalAnalyze<T>,
 	                           BitpackingInitCompression<T, WRITE_STATISTICS>, BitpackingCompress<T, WRITE_STATISTICS>,
 	                           BitpackingFinalizeCompress<T, WRITE_STATISTICS>, BitpackingInitScan<T>,
-	                           BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
+	                           BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>,
+	                           nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+	                           GetBitpackingFilter<T>());
 }
 
 CompressionFunction BitpackingFun::GetFunction(PhysicalType type) {
@@ -5,6 +5,7 @@
 #include "duckdb/common/types/vector_buffer.hpp"
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/compression/compressed_filter.hpp"
 #include "duckdb/storage/segment/uncompressed.hpp"
 #include "duckdb/storage/string_uncompressed.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
@@ -107,6 +108,8 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static bool StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+	                         SelectionVector &sel, idx_t &sel_count, const TableFilter &filter);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -444,6 +447,9 @@ struct CompressedStringScanState : public StringScanState {
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	//! The filter that was evaluated on the dictionary, and whether or not each dictionary entry passes it
+	optional_ptr<const TableFilter> filter;
+	unsafe_unique_array<bool> filter_matches;
 };
 
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
@@ -554,6 +560,61 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+bool DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                                Vector &result, SelectionVector &sel, idx_t &sel_count,
+                                                const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	auto dict_data = FlatVector::GetData<string_t>(*scan_state.dictionary);
+	if (scan_state.filter.get() != &filter) {
+		// evaluate the filter once for every string in the dictionary
+		CompressedFilter<string_t> compressed_filter;
+		if (!compressed_filter.Initialize(filter)) {
+			return false;
+		}
+		auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+		auto header_ptr = reinterpret_cast<dictionary_compression_header_t *>(baseptr);
+		auto index_buffer_count = Load<uint32_t>(data_ptr_cast(&header_ptr->index_buffer_count));
+		scan_state.filter_matches = make_unsafe_uniq_array<bool>(index_buffer_count);
+		for (idx_t i = 0; i < index_buffer_count; i++) {
+			scan_state.filter_matches[i] = compressed_filter.Matches(dict_data[i]);
+		}
+		scan_state.filter = &filter;
+	}
+
+	// unpack the dictionary indices of this vector
+	auto start = segment.GetRelativeIndex(state.row_index);
+	idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+	idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(vector_count + start_offset);
+	if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
+		scan_state.sel_vec_size = decompress_count;
+		scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
+	}
+	auto base_data = data_ptr_cast(scan_state.handle.Ptr() + segment.GetBlockOffset() + DICTIONARY_HEADER_SIZE);
+	data_ptr_t src = &base_data[((start - start_offset) * scan_state.current_width) / 8];
+	BitpackingPrimitives::UnPackBuffer<sel_t>(data_ptr_cast(scan_state.sel_vec->data()), src, decompress_count,
+	                                          scan_state.current_width);
+
+	// look up whether or not the dictionary entry of every selected row passes the filter
+	auto &indices = *scan_state.sel_vec;
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	SelectionVector result_sel(sel_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto idx = sel.get_index(i);
+		auto string_number = indices.get_index(idx + start_offset);
+		result_data[idx] = dict_data[string_number];
+		result_sel.set_index(result_count, idx);
+		result_count += scan_state.filter_matches[string_number];
+	}
+	sel.Initialize(result_sel);
+	sel_count = result_count;
+	return true;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -657,7 +718,8 @@ CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
-	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip, nullptr, nullptr, nullptr,
+	    nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, DictionaryCompressionStorage::StringFilter);
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(const PhysicalType physical_type) {
@@ -0,0 +1,588 @@
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/segment/uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Layout
+//===--------------------------------------------------------------------===//
+// PFOR-Delta splits a segment into groups of PFOR_DELTA_GROUP_SIZE values. Every group is encoded in one of three
+// orders: order 0 is plain frame-of-reference, order 1 stores the bitpacked deltas between consecutive values and
+// order 2 stores the bitpacked delta-of-deltas. For orders 1 and 2 the first value(s) of a group are reconstructed by
+// seeding the prefix sums with offsets, so that decoding is a bitpacked unpack followed by `order` prefix sums.
+//
+// Segment layout:
+// [idx_t metadata offset] [group 0] [group 1] ... [metadata of group n] ... [metadata of group 0]
+// Group layout:
+// [T reference] [T width] [T offset] * order [bitpacked residuals]
+// Because all groups hold exactly PFOR_DELTA_GROUP_SIZE values (apart from the last one) we can seek to any row in
+// constant time.
+static constexpr const idx_t PFOR_DELTA_GROUP_SIZE = 1024;
+static constexpr const idx_t PFOR_DELTA_MAX_ORDER = 2;
+
+typedef uint32_t pfor_delta_metadata_t;
+
+static pfor_delta_metadata_t EncodePForDeltaMeta(idx_t order, idx_t offset) {
+	D_ASSERT(offset <= 0x00FFFFFF); // max uint24_t
+	return UnsafeNumericCast<pfor_delta_metadata_t>(offset | (order << 24));
+}
+
+static idx_t DecodePForDeltaOrder(pfor_delta_metadata_t metadata) {
+	return metadata >> 24;
+}
+
+static idx_t DecodePForDeltaOffset(pfor_delta_metadata_t metadata) {
+	return metadata & 0x00FFFFFF;
+}
+
+template <class T>
+static idx_t PForDeltaHeaderSize(idx_t order) {
+	return sizeof(T) * (2 + order);
+}
+
+//! Buffers a group of values and determines the cheapest order to encode it in
+template <class T>
+struct PForDeltaState {
+	using T_U = typename MakeUnsigned<T>::type;
+	using T_S = typename MakeSigned<T>::type;
+
+public:
+	PForDeltaState() {
+		Reset();
+	}
+
+	//! The values of the group - NULL values are replaced by the previous value so they do not affect the deltas
+	T_U values[PFOR_DELTA_GROUP_SIZE];
+	//! The residuals (i.e. the values that are bitpacked) of the chosen order
+	T_U residuals[PFOR_DELTA_GROUP_SIZE];
+	idx_t count;
+	idx_t total_size = 0;
+
+	bool has_valid;
+	T minimum;
+	T maximum;
+
+	//! The encoding that was chosen for the group
+	idx_t order;
+	bitpacking_width_t width;
+	T_U reference;
+	T_U offsets[PFOR_DELTA_MAX_ORDER];
+
+public:
+	void Reset() {
+		count = 0;
+		has_valid = false;
+		minimum = NumericLimits<T>::Maximum();
+		maximum = NumericLimits<T>::Minimum();
+	}
+
+	bool IsFull() const {
+		return count == PFOR_DELTA_GROUP_SIZE;
+	}
+
+	void Update(T value, bool is_valid) {
+		D_ASSERT(!IsFull());
+		if (!is_valid) {
+			values[count] = count > 0 ? values[count - 1] : T_U(0);
+			count++;
+			return;
+		}
+		if (!has_valid) {
+			// back-fill any leading NULL values with the first valid value
+			for (idx_t i = 0; i < count; i++) {
+				values[i] = static_cast<T_U>(value);
+			}
+			has_valid = true;
+		}
+		values[count++] = static_cast<T_U>(value);
+		minimum = MinValue<T>(minimum, value);
+		maximum = MaxValue<T>(maximum, value);
+	}
+
+	//! Returns the number of bytes required to store the group, and sets the order, width and reference
+	idx_t Analyze() {
+		D_ASSERT(count > 0);
+		// order 0: frame-of-reference over the values themselves
+		T min_value = static_cast<T>(values[0]);
+		T max_value = static_cast<T>(values[0]);
+		for (idx_t i = 1; i < count; i++) {
+			min_value = MinValue<T>(min_value, static_cast<T>(values[i]));
+			max_value = MaxValue<T>(max_value, static_cast<T>(values[i]));
+		}
+		SetCandidate(0, static_cast<T_U>(min_value), static_cast<T_U>(max_value));
+
+		// order 1 and 2: frame-of-reference over the (signed) deltas and delta-of-deltas
+		// all arithmetic wraps around, which is fine because decoding uses the same modular arithmetic
+		T_S min_delta = NumericLimits<T_S>::Maximum();
+		T_S max_delta = NumericLimits<T_S>::Minimum();
+		T_S min_delta_of_delta = NumericLimits<T_S>::Maximum();
+		T_S max_delta_of_delta = NumericLimits<T_S>::Minimum();
+		for (idx_t i = 1; i < count; i++) {
+			auto delta = static_cast<T_S>(static_cast<T_U>(values[i] - values[i - 1]));
+			min_delta = MinValue<T_S>(min_delta, delta);
+			max_delta = MaxValue<T_S>(max_delta, delta);
+			if (i >= 2) {
+				auto delta_of_delta = static_cast<T_S>(static_cast<T_U>(delta - Delta(i - 1)));
+				min_delta_of_delta = MinValue<T_S>(min_delta_of_delta, delta_of_delta);
+				max_delta_of_delta = MaxValue<T_S>(max_delta_of_delta, delta_of_delta);
+			}
+		}
+		if (count > 1) {
+			SetCandidate(1, static_cast<T_U>(min_delta), static_cast<T_U>(max_delta));
+		}
+		if (count > 2) {
+			SetCandidate(2, static_cast<T_U>(min_delta_of_delta), static_cast<T_U>(max_delta_of_delta));
+		}
+		return GroupSize(order, width);
+	}
+
+	//! Computes the residuals and prefix sum offsets for the chosen order
+	void Encode() {
+		memset(residuals, 0, sizeof(residuals));
+		switch (order) {
+		case 0:
+			for (idx_t i = 0; i < count; i++) {
+				residuals[i] = static_cast<T_U>(values[i] - reference);
+			}
+			break;
+		case 1:
+			for (idx_t i = 1; i < count; i++) {
+				residuals[i] = static_cast<T_U>(Delta(i) - reference);
+			}
+			// the first prefix sum turns residuals[0] + reference into the first value
+			offsets[0] = static_cast<T_U>(values[0] - reference);
+			break;
+		case 2:
+			for (idx_t i = 2; i < count; i++) {
+				residuals[i] = static_cast<T_U>(Delta(i) - Delta(i - 1) - reference);
+			}
+			// the first prefix sum needs to produce the first delta at position 1
+			// the second prefix sum then needs to produce the first value at position 0
+			offsets[0] = static_cast<T_U>(Delta(1) - reference - reference);
+			offsets[1] = static_cast<T_U>(values[0] - Delta(1) + reference);
+			break;
+		default:
+			throw InternalException("Invalid PFOR-Delta order");
+		}
+	}
+
+private:
+	T_U Delta(idx_t i) const {
+		return static_cast<T_U>(values[i] - values[i - 1]);
+	}
+
+	idx_t GroupSize(idx_t candidate_order, bitpacking_width_t candidate_width) const {
+		return PForDeltaHeaderSize<T>(candidate_order) + sizeof(pfor_delta_metadata_t) +
+		       BitpackingPrimitives::GetRequiredSize(count, candidate_width);
+	}
+
+	void SetCandidate(idx_t candidate_order, T_U min_value, T_U max_value) {
+		auto range = static_cast<T_U>(max_value - min_value);
+		auto candidate_width = BitpackingPrimitives::MinimumBitWidth<T_U, false>(range);
+		if (candidate_order > 0 && GroupSize(candidate_order, candidate_width) >= GroupSize(order, width)) {
+			return;
+		}
+		order = candidate_order;
+		width = candidate_width;
+		reference = min_value;
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaAnalyzeState : public AnalyzeState {
+	explicit PForDeltaAnalyzeState(const CompressionInfo &info) : AnalyzeState(info) {
+	}
+
+	PForDeltaState<T> state;
+};
+
+template <class T>
+unique_ptr<AnalyzeState> PForDeltaInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	return make_uniq<PForDeltaAnalyzeState<T>>(info);
+}
+
+template <class T>
+bool PForDeltaAnalyze(AnalyzeState &state, Vector &input, idx_t count) {
+	auto &analyze_state = state.Cast<PForDeltaAnalyzeState<T>>();
+
+	// a group always has to fit within a single block - we are conservative here by multiplying by 2
+	if (sizeof(T) * PFOR_DELTA_GROUP_SIZE * 2 > state.info.GetBlockSize()) {
+		return false;
+	}
+
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	auto &group = analyze_state.state;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		group.Update(data[idx], vdata.validity.RowIsValid(idx));
+		if (group.IsFull()) {
+			group.total_size += group.Analyze();
+			group.Reset();
+		}
+	}
+	return true;
+}
+
+template <class T>
+idx_t PForDeltaFinalAnalyze(AnalyzeState &state) {
+	auto &group = state.Cast<PForDeltaAnalyzeState<T>>().state;
+	if (group.count > 0) {
+		group.total_size += group.Analyze();
+		group.Reset();
+	}
+	return group.total_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaCompressState : public CompressionState {
+	using T_U = typename MakeUnsigned<T>::type;
+
+public:
+	PForDeltaCompressState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA)) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	//! Ptr to next free spot in segment
+	data_ptr_t data_ptr;
+	//! Ptr to next free spot for storing the group metadata (growing downwards)
+	data_ptr_t metadata_ptr;
+
+	PForDeltaState<T> state;
+
+public:
+	bool CanStore(idx_t data_bytes, idx_t meta_bytes) {
+		auto required_data_bytes = AlignValue<idx_t>(NumericCast<idx_t>(data_ptr - handle.Ptr()) + data_bytes);
+		auto required_meta_bytes = NumericCast<idx_t>(handle.Ptr() + info.GetBlockSize() - metadata_ptr) + meta_bytes;
+		return required_data_bytes + required_meta_bytes <= info.GetBlockSize();
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+
+		auto compressed_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		compressed_segment->function = function;
+		current_segment = std::move(compressed_segment);
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + BitpackingPrimitives::BITPACKING_HEADER_SIZE;
+		metadata_ptr = handle.Ptr() + info.GetBlockSize();
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = UnifiedVectorFormat::GetData<T>(vdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			state.Update(data[idx], vdata.validity.RowIsValid(idx));
+			if (state.IsFull()) {
+				FlushGroup();
+			}
+		}
+	}
+
+	void FlushGroup() {
+		if (state.count == 0) {
+			return;
+		}
+		state.Analyze();
+		state.Encode();
+
+		auto header_size = PForDeltaHeaderSize<T>(state.order);
+		auto packed_size = BitpackingPrimitives::GetRequiredSize(state.count, state.width);
+		if (!CanStore(header_size + packed_size, sizeof(pfor_delta_metadata_t))) {
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+		D_ASSERT(CanStore(header_size + packed_size, sizeof(pfor_delta_metadata_t)));
+
+		metadata_ptr -= sizeof(pfor_delta_metadata_t);
+		Store<pfor_delta_metadata_t>(
+		    EncodePForDeltaMeta(state.order, NumericCast<idx_t>(data_ptr - handle.Ptr())), metadata_ptr);
+
+		Store<T_U>(state.reference, data_ptr);
+		data_ptr += sizeof(T);
+		Store<T_U>(static_cast<T_U>(state.width), data_ptr);
+		data_ptr += sizeof(T);
+		for (idx_t i = 0; i < state.order; i++) {
+			Store<T_U>(state.offsets[i], data_ptr);
+			data_ptr += sizeof(T);
+		}
+		BitpackingPrimitives::PackBuffer<T_U, true>(data_ptr, state.residuals,
+		                                            BitpackingPrimitives::RoundUpToAlgorithmGroupSize(state.count),
+		                                            state.width);
+		data_ptr += packed_size;
+
+		current_segment->count += state.count;
+		if (state.has_valid) {
+			NumericStats::Update<T>(current_segment->stats.statistics, state.minimum);
+			NumericStats::Update<T>(current_segment->stats.statistics, state.maximum);
+		}
+		state.Reset();
+	}
+
+	void FlushSegment() {
+		auto &checkpoint_state = checkpointer.GetCheckpointState();
+		auto base_ptr = handle.Ptr();
+
+		// compact the segment by moving the metadata next to the data
+		auto unaligned_offset = NumericCast<idx_t>(data_ptr - base_ptr);
+		auto metadata_offset = AlignValue(unaligned_offset);
+		auto metadata_size = NumericCast<idx_t>(base_ptr + info.GetBlockSize() - metadata_ptr);
+		auto total_segment_size = metadata_offset + metadata_size;
+		if (unaligned_offset != metadata_offset) {
+			// zero initialize any padding bits
+			memset(base_ptr + unaligned_offset, 0, metadata_offset - unaligned_offset);
+		}
+		memmove(base_ptr + metadata_offset, metadata_ptr, metadata_size);
+
+		// store the offset of the end of the metadata (i.e. the metadata of the first group)
+		Store<idx_t>(metadata_offset + metadata_size, base_ptr);
+		handle.Destroy();
+
+		checkpoint_state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		FlushGroup();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+template <class T>
+unique_ptr<CompressionState> PForDeltaInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                      unique_ptr<AnalyzeState> state) {
+	return make_uniq<PForDeltaCompressState<T>>(checkpointer, state->info);
+}
+
+template <class T>
+void PForDeltaCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T>>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T>
+void PForDeltaFinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T>>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+// Based on https://github.com/lemire/FastPFor (Apache License 2.0)
+template <class T_U>
+static void PForDeltaPrefixSum(T_U *data, T_U offset, idx_t count) {
+	data[0] += offset;
+	idx_t i = 1;
+	for (; i + 4 <= count; i += 4) {
+		data[i] += data[i - 1];
+		data[i + 1] += data[i];
+		data[i + 2] += data[i + 1];
+		data[i + 3] += data[i + 2];
+	}
+	for (; i < count; i++) {
+		data[i] += data[i - 1];
+	}
+}
+
+template <class T>
+struct PForDeltaScanState : public SegmentScanState {
+	using T_U = typename MakeUnsigned<T>::type;
+
+public:
+	explicit PForDeltaScanState(ColumnSegment &segment) : segment(segment) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		base_ptr = handle.Ptr() + segment.GetBlockOffset();
+		// the metadata of the first group is stored at the highest address
+		metadata_ptr = base_ptr + Load<idx_t>(base_ptr) - sizeof(pfor_delta_metadata_t);
+	}
+
+	ColumnSegment &segment;
+	BufferHandle handle;
+	data_ptr_t base_ptr;
+	data_ptr_t metadata_ptr;
+
+	//! The most recently decoded group
+	T_U decompression_buffer[PFOR_DELTA_GROUP_SIZE];
+	idx_t decoded_group = DConstants::INVALID_INDEX;
+
+public:
+	idx_t GroupCount(idx_t group_idx) const {
+		return MinValue<idx_t>(PFOR_DELTA_GROUP_SIZE, segment.count - group_idx * PFOR_DELTA_GROUP_SIZE);
+	}
+
+	//! Decodes a full group into the target, the target needs to be able to hold a multiple of the
+	//! bitpacking algorithm group size
+	void DecodeGroup(idx_t group_idx, T_U *target) {
+		auto metadata = Load<pfor_delta_metadata_t>(metadata_ptr - group_idx * sizeof(pfor_delta_metadata_t));
+		auto order = DecodePForDeltaOrder(metadata);
+		auto group_ptr = base_ptr + DecodePForDeltaOffset(metadata);
+		D_ASSERT(order <= PFOR_DELTA_MAX_ORDER);
+
+		auto reference = Load<T_U>(group_ptr);
+		auto width = static_cast<bitpacking_width_t>(Load<T_U>(group_ptr + sizeof(T)));
+		T_U offsets[PFOR_DELTA_MAX_ORDER];
+		for (idx_t i = 0; i < order; i++) {
+			offsets[i] = Load<T_U>(group_ptr + (2 + i) * sizeof(T));
+		}
+		auto count = GroupCount(group_idx);
+		BitpackingPrimitives::UnPackBuffer<T_U>(data_ptr_cast(target), group_ptr + PForDeltaHeaderSize<T>(order),
+		                                        BitpackingPrimitives::RoundUpToAlgorithmGroupSize(count), width, true);
+		for (idx_t i = 0; i < count; i++) {
+			target[i] += reference;
+		}
+		for (idx_t i = 0; i < order; i++) {
+			PForDeltaPrefixSum<T_U>(target, offsets[i], count);
+		}
+	}
+
+	const T_U *GetGroup(idx_t group_idx) {
+		if (decoded_group != group_idx) {
+			DecodeGroup(group_idx, decompression_buffer);
+			decoded_group = group_idx;
+		}
+		return decompression_buffer;
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> PForDeltaInitScan(ColumnSegment &segment) {
+	return make_uniq<PForDeltaScanState<T>>(segment);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+template <class T>
+void PForDeltaScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                          idx_t result_offset) {
+	using T_U = typename MakeUnsigned<T>::type;
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto position = start + scanned;
+		auto group_idx = position / PFOR_DELTA_GROUP_SIZE;
+		auto offset_in_group = position % PFOR_DELTA_GROUP_SIZE;
+		auto group_count = scan_state.GroupCount(group_idx);
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, group_count - offset_in_group);
+
+		auto target = reinterpret_cast<T_U *>(result_data + result_offset + scanned);
+		if (to_scan == PFOR_DELTA_GROUP_SIZE) {
+			// decode the full group directly into the result vector
+			scan_state.DecodeGroup(group_idx, target);
+		} else {
+			auto group = scan_state.GetGroup(group_idx);
+			memcpy(target, group + offset_in_group, to_scan * sizeof(T));
+		}
+		scanned += to_scan;
+	}
+}
+
+template <class T>
+void PForDeltaScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	PForDeltaScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+template <class T>
+void PForDeltaFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                       idx_t result_idx) {
+	PForDeltaScanState<T> scan_state(segment);
+	auto row = NumericCast<idx_t>(row_id);
+	auto group = scan_state.GetGroup(row / PFOR_DELTA_GROUP_SIZE);
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result_data[result_idx] = static_cast<T>(group[row % PFOR_DELTA_GROUP_SIZE]);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+template <class T>
+CompressionFunction GetPForDeltaFunction(PhysicalType data_type) {
+	return CompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA, data_type, PForDeltaInitAnalyze<T>,
+	                           PForDeltaAnalyze<T>, PForDeltaFinalAnalyze<T>, PForDeltaInitCompression<T>,
+	                           PForDeltaCompress<T>, PForDeltaFinalizeCompress<T>, PForDeltaInitScan<T>,
+	                           PForDeltaScan<T>, PForDeltaScanPartial<T>, PForDeltaFetchRow<T>,
+	                           UncompressedFunctions::EmptySkip);
+}
+
+CompressionFunction PForDeltaFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT8:
+		return GetPForDeltaFunction<int8_t>(type);
+	case PhysicalType::INT16:
+		return GetPForDeltaFunction<int16_t>(type);
+	case PhysicalType::INT32:
+		return GetPForDeltaFunction<int32_t>(type);
+	case PhysicalType::INT64:
+		return GetPForDeltaFunction<int64_t>(type);
+	case PhysicalType::UINT8:
+		return GetPForDeltaFunction<uint8_t>(type);
+	case PhysicalType::UINT16:
+		return GetPForDeltaFunction<uint16_t>(type);
+	case PhysicalType::UINT32:
+		return GetPForDeltaFunction<uint32_t>(type);
+	case PhysicalType::UINT64:
+		return GetPForDeltaFunction<uint64_t>(type);
+	default:
+		throw InternalException("Unsupported type for PFOR-Delta");
+	}
+}
+
+bool PForDeltaFun::TypeIsSupported(const PhysicalType physical_type) {
+	switch (physical_type) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
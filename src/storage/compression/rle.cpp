@@ -2,6 +2,7 @@
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/compression/compressed_filter.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -374,6 +375,54 @@ void RLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, V
 	RLEScanPartialInternal<T, true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+bool RLEFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result, SelectionVector &sel,
+               idx_t &sel_count, const TableFilter &filter) {
+	CompressedFilter<T> compressed_filter;
+	if (!compressed_filter.Initialize(filter)) {
+		return false;
+	}
+	auto &scan_state = state.scan_state->Cast<RLEScanState<T>>();
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = reinterpret_cast<T *>(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = reinterpret_cast<rle_count_t *>(data + scan_state.rle_count_offset);
+
+	auto result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	// evaluate the filter once per run, and only write the values of the rows that pass it
+	SelectionVector result_sel(sel_count);
+	idx_t result_count = 0;
+	idx_t sel_idx = 0;
+	idx_t scanned = 0;
+	while (scanned < vector_count) {
+		auto run_value = data_pointer[scan_state.entry_pos];
+		auto run_count = MinValue<idx_t>(index_pointer[scan_state.entry_pos] - scan_state.position_in_entry,
+		                                 vector_count - scanned);
+		auto run_end = scanned + run_count;
+		auto matches = compressed_filter.Matches(run_value);
+		for (; sel_idx < sel_count && sel.get_index(sel_idx) < run_end; sel_idx++) {
+			if (matches) {
+				auto idx = sel.get_index(sel_idx);
+				result_data[idx] = run_value;
+				result_sel.set_index(result_count++, idx);
+			}
+		}
+		scanned = run_end;
+		scan_state.position_in_entry += run_count;
+		if (ExhaustedRun(scan_state, index_pointer)) {
+			ForwardToNextRun(scan_state);
+		}
+	}
+	sel.Initialize(result_sel);
+	sel_count = result_count;
+	return true;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -396,7 +445,8 @@ CompressionFunction GetRLEFunction(PhysicalType data_type) {
 	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
 	                           RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
 	                           RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
-	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>, nullptr,
+	                           nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, RLEFilter<T>);
 }
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
@@ -834,9 +834,25 @@ void DataTable::FinalizeOptimisticWriter(ClientContext &context, OptimisticDataW
 	local_storage.FinalizeOptimisticWriter(*this, writer);
 }
 
-void DataTable::LocalMerge(ClientContext &context, RowGroupCollection &collection) {
+unique_ptr<LocalIndexAppend> DataTable::InitializeLocalIndexAppend(ClientContext &context,
+                                                                   RowGroupCollection &collection) {
 	auto &local_storage = LocalStorage::Get(context, db);
-	local_storage.LocalMerge(*this, collection);
+	return local_storage.InitializeIndexAppend(*this, collection);
+}
+
+void DataTable::LocalMerge(ClientContext &context, RowGroupCollection &collection,
+                           optional_ptr<LocalIndexAppend> index_append) {
+	auto &local_storage = LocalStorage::Get(context, db);
+	local_storage.LocalMerge(*this, collection, index_append);
+}
+
+void DataTable::FinalizeLocalIndexAppends(ClientContext &context,
+                                          vector<unique_ptr<LocalIndexAppend>> &index_appends) {
+	if (index_appends.empty()) {
+		return;
+	}
+	auto &local_storage = LocalStorage::Get(context, db);
+	local_storage.FinalizeIndexAppends(*this, index_appends);
 }
 
 void DataTable::LocalAppend(TableCatalogEntry &table, ClientContext &context, DataChunk &chunk,
@@ -1460,4 +1476,9 @@ vector<ColumnSegmentInfo> DataTable::GetColumnSegmentInfo() {
 	return row_groups->GetColumnSegmentInfo();
 }
 
+RowGroupCompactionInfo DataTable::GetCompactionInfo() {
+	auto lock = GetSharedCheckpointLock();
+	return row_groups->GetCompactionInfo();
+}
+
 } // namespace duckdb
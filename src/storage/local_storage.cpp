@@ -11,9 +11,21 @@
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/parallel/task_executor.hpp"
 
 namespace duckdb {
 
+//! Creates an empty ART that maintains the same constraint as the given ART
+static unique_ptr<ART> CreateLocalIndex(ART &art) {
+	vector<unique_ptr<Expression>> unbound_expressions;
+	unbound_expressions.reserve(art.unbound_expressions.size());
+	for (auto &expr : art.unbound_expressions) {
+		unbound_expressions.push_back(expr->Copy());
+	}
+	return make_uniq<ART>(art.GetIndexName(), art.GetConstraintType(), art.GetColumnIds(), art.table_io_manager,
+	                      std::move(unbound_expressions), art.db);
+}
+
 LocalTableStorage::LocalTableStorage(ClientContext &context, DataTable &table)
     : table_ref(table), allocator(Allocator::Get(table.db)), deleted_rows(0), optimistic_writer(table),
       merged_storage(false) {
@@ -26,13 +38,7 @@ LocalTableStorage::LocalTableStorage(ClientContext &context, DataTable &table)
 	data_table_info->GetIndexes().BindAndScan<ART>(context, *data_table_info, [&](ART &art) {
 		if (art.GetConstraintType() != IndexConstraintType::NONE) {
 			// unique index: create a local ART index that maintains the same unique constraint
-			vector<unique_ptr<Expression>> unbound_expressions;
-			unbound_expressions.reserve(art.unbound_expressions.size());
-			for (auto &expr : art.unbound_expressions) {
-				unbound_expressions.push_back(expr->Copy());
-			}
-			indexes.AddIndex(make_uniq<ART>(art.GetIndexName(), art.GetConstraintType(), art.GetColumnIds(),
-			                                art.table_io_manager, std::move(unbound_expressions), art.db));
+			indexes.AddIndex(CreateLocalIndex(art));
 		}
 		return false;
 	});
@@ -375,20 +381,119 @@ void LocalStorage::FinalizeAppend(LocalAppendState &state) {
 	state.storage->row_groups->FinalizeAppend(state.append_state.transaction, state.append_state);
 }
 
-void LocalStorage::LocalMerge(DataTable &table, RowGroupCollection &collection) {
+unique_ptr<LocalIndexAppend> LocalStorage::InitializeIndexAppend(DataTable &table, RowGroupCollection &collection) {
+	auto &storage = table_manager.GetOrCreateStorage(context, table);
+	if (storage.indexes.Empty()) {
+		return nullptr;
+	}
+	auto result = make_uniq<LocalIndexAppend>();
+	result->column_ids = storage.indexes.GetRequiredColumns();
+	auto table_types = table.GetTypes();
+	vector<LogicalType> types;
+	for (auto &column_id : result->column_ids) {
+		types.push_back(table_types[column_id]);
+	}
+	result->data = make_uniq<ColumnDataCollection>(context, std::move(types));
+	ColumnDataAppendState append_state;
+	result->data->InitializeAppend(append_state);
+	collection.Scan(transaction, result->column_ids, [&](DataChunk &chunk) -> bool {
+		result->data->Append(append_state, chunk);
+		return true;
+	});
+	return result;
+}
+
+void LocalStorage::LocalMerge(DataTable &table, RowGroupCollection &collection,
+                              optional_ptr<LocalIndexAppend> index_append) {
 	auto &storage = table_manager.GetOrCreateStorage(context, table);
 	if (!storage.indexes.Empty()) {
 		// append data to indexes if required
 		row_t base_id = MAX_ROW_ID + NumericCast<row_t>(storage.row_groups->GetTotalRows());
-		auto error = storage.AppendToIndexes(transaction, collection, storage.indexes, table.GetTypes(), base_id);
-		if (error.HasError()) {
-			error.Throw();
+		if (index_append) {
+			// the rows are appended to the indexes by FinalizeIndexAppends
+			index_append->row_start = base_id;
+		} else {
+			auto error = storage.AppendToIndexes(transaction, collection, storage.indexes, table.GetTypes(), base_id);
+			if (error.HasError()) {
+				error.Throw();
+			}
 		}
 	}
 	storage.row_groups->MergeStorage(collection, nullptr, nullptr);
 	storage.merged_storage = true;
 }
 
+void LocalStorage::FinalizeIndexAppend(DataTable &table, LocalIndexAppend &index_append) {
+	auto &storage = table_manager.GetOrCreateStorage(context, table);
+
+	// construct the index entries in separate indexes, so that we only hold the locks on the transaction-local
+	// indexes while merging the (much cheaper to merge than to construct) trees
+	vector<reference<BoundIndex>> target_indexes;
+	TableIndexList append_indexes;
+	storage.indexes.Scan([&](Index &index) {
+		auto &art = index.Cast<ART>();
+		target_indexes.push_back(art);
+		append_indexes.AddIndex(CreateLocalIndex(art));
+		return false;
+	});
+
+	DataChunk mock_chunk;
+	mock_chunk.InitializeEmpty(table.GetTypes());
+	auto start_row = index_append.row_start;
+	for (auto &chunk : index_append.data->Chunks()) {
+		for (idx_t i = 0; i < index_append.column_ids.size(); i++) {
+			mock_chunk.data[index_append.column_ids[i]].Reference(chunk.data[i]);
+		}
+		mock_chunk.SetCardinality(chunk);
+		auto error = DataTable::AppendToIndexes(append_indexes, mock_chunk, start_row);
+		if (error.HasError()) {
+			error.Throw();
+		}
+		start_row += UnsafeNumericCast<row_t>(chunk.size());
+	}
+	index_append.data.reset();
+
+	// merge the indexes into the transaction-local indexes
+	idx_t index_idx = 0;
+	append_indexes.Scan([&](Index &index) {
+		auto &target_index = target_indexes[index_idx++].get();
+		if (!target_index.MergeIndexes(index.Cast<BoundIndex>())) {
+			throw ConstraintException("PRIMARY KEY or UNIQUE constraint violated: duplicate key in index \"%s\"",
+			                          target_index.GetIndexName());
+		}
+		return false;
+	});
+}
+
+class LocalIndexAppendTask : public BaseExecutorTask {
+public:
+	LocalIndexAppendTask(TaskExecutor &executor, LocalStorage &local_storage, DataTable &table,
+	                     LocalIndexAppend &index_append)
+	    : BaseExecutorTask(executor), local_storage(local_storage), table(table), index_append(index_append) {
+	}
+
+	void ExecuteTask() override {
+		local_storage.FinalizeIndexAppend(table, index_append);
+	}
+
+private:
+	LocalStorage &local_storage;
+	DataTable &table;
+	LocalIndexAppend &index_append;
+};
+
+void LocalStorage::FinalizeIndexAppends(DataTable &table, vector<unique_ptr<LocalIndexAppend>> &index_appends) {
+	if (index_appends.size() == 1) {
+		FinalizeIndexAppend(table, *index_appends[0]);
+		return;
+	}
+	TaskExecutor executor(context);
+	for (auto &index_append : index_appends) {
+		executor.ScheduleTask(make_uniq<LocalIndexAppendTask>(executor, *this, table, *index_append));
+	}
+	executor.WorkOnTasks();
+}
+
 OptimisticDataWriter &LocalStorage::CreateOptimisticWriter(DataTable &table) {
 	auto &storage = table_manager.GetOrCreateStorage(context, table);
 	return storage.CreateOptimisticWriter();
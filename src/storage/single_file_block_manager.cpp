@@ -3,6 +3,7 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/resource_counters.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
@@ -467,6 +468,7 @@ void SingleFileBlockManager::Read(Block &block) {
 	D_ASSERT(block.id >= 0);
 	D_ASSERT(std::find(free_list.begin(), free_list.end(), block.id) == free_list.end());
 	ReadAndChecksum(block, GetBlockLocation(block.id));
+	ThreadResourceCounters::AddStorageBytesRead(block.AllocSize());
 }
 
 void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) {
@@ -476,7 +478,29 @@ void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_blo
 	// read the buffer from disk
 	auto location = GetBlockLocation(start_block);
 	buffer.Read(*handle, location);
+	ThreadResourceCounters::AddStorageBytesRead(buffer.AllocSize());
+	VerifyBlocks(buffer, location, block_count);
+}
+
+void SingleFileBlockManager::ReadBlocks(const vector<BlockReadRun> &runs) {
+	// submit the reads of all runs as a single batch
+	vector<FileReadRequest> requests;
+	for (auto &run : runs) {
+		D_ASSERT(run.start_block >= 0);
+		D_ASSERT(run.block_count >= 1);
+		auto &buffer = run.buffer.get();
+		requests.emplace_back(buffer.InternalBuffer(), buffer.AllocSize(), GetBlockLocation(run.start_block));
+	}
+	handle->ReadBatch(requests);
+
+	for (auto &run : runs) {
+		auto &buffer = run.buffer.get();
+		ThreadResourceCounters::AddStorageBytesRead(buffer.AllocSize());
+		VerifyBlocks(buffer, GetBlockLocation(run.start_block), run.block_count);
+	}
+}
 
+void SingleFileBlockManager::VerifyBlocks(FileBuffer &buffer, idx_t location, idx_t block_count) {
 	// for each of the blocks - verify the checksum
 	auto ptr = buffer.InternalBuffer();
 	for (idx_t i = 0; i < block_count; i++) {
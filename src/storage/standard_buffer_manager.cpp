@@ -3,6 +3,7 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/resource_counters.hpp"
 #include "duckdb/common/set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database.hpp"
@@ -208,23 +209,40 @@ void StandardBufferManager::ReAllocate(shared_ptr<BlockHandle> &handle, idx_t bl
 }
 
 void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
-                                      block_id_t first_block, block_id_t last_block) {
+                                      const vector<pair<block_id_t, block_id_t>> &runs) {
 	auto &block_manager = handles[0]->block_manager;
-	idx_t block_count = NumericCast<idx_t>(last_block - first_block + 1);
 #ifndef DUCKDB_ALTERNATIVE_VERIFY
-	if (block_count == 1) {
-		// prefetching with block_count == 1 has no performance impact since we can't batch reads
+	if (runs.size() == 1 && runs[0].first == runs[0].second) {
+		// prefetching a single block has no performance impact since we can't batch reads
 		// skip the prefetch in this case
 		// we do it anyway if alternative_verify is on for extra testing
 		return;
 	}
 #endif
 
-	// allocate a buffer to hold the data of all of the blocks
-	auto intermediate_buffer = Allocate(MemoryTag::BASE_TABLE, block_count * block_manager.GetBlockSize());
-	// perform a batch read of the blocks into the buffer
-	block_manager.ReadBlocks(intermediate_buffer.GetFileBuffer(), first_block, block_count);
+	// allocate a buffer for every run to hold the data of all of its blocks
+	vector<BufferHandle> intermediate_buffers;
+	vector<BlockReadRun> block_runs;
+	intermediate_buffers.reserve(runs.size());
+	for (auto &run : runs) {
+		auto block_count = NumericCast<idx_t>(run.second - run.first + 1);
+		intermediate_buffers.push_back(Allocate(MemoryTag::BASE_TABLE, block_count * block_manager.GetBlockSize()));
+		block_runs.emplace_back(intermediate_buffers.back().GetFileBuffer(), run.first, block_count);
+	}
+	// perform a batch read of the runs, the block manager can have the reads of all runs in flight at the same time
+	block_manager.ReadBlocks(block_runs);
+
+	for (idx_t run_idx = 0; run_idx < runs.size(); run_idx++) {
+		LoadBlocksFromBuffer(handles, load_map, intermediate_buffers[run_idx], runs[run_idx].first,
+		                     block_runs[run_idx].block_count);
+	}
+}
 
+void StandardBufferManager::LoadBlocksFromBuffer(vector<shared_ptr<BlockHandle>> &handles,
+                                                 const map<block_id_t, idx_t> &load_map,
+                                                 BufferHandle &intermediate_buffer, block_id_t first_block,
+                                                 idx_t block_count) {
+	auto &block_manager = handles[0]->block_manager;
 	// the blocks are read - now we need to assign them to the individual blocks
 	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
 		block_id_t block_id = first_block + NumericCast<block_id_t>(block_idx);
@@ -273,7 +291,11 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 		// nothing to fetch
 		return;
 	}
-	// iterate over the blocks and perform bulk reads
+	// iterate over the blocks and group them into runs of adjacent blocks
+	// the runs are read in batches, so that the reads of (up to) MAX_PREFETCH_BATCH_BLOCKS blocks are in flight at once
+	static constexpr idx_t MAX_PREFETCH_BATCH_BLOCKS = 64;
+	vector<pair<block_id_t, block_id_t>> runs;
+	idx_t batch_block_count = 0;
 	block_id_t first_block = -1;
 	block_id_t previous_block_id = -1;
 	for (auto &entry : to_be_loaded) {
@@ -282,12 +304,17 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 			first_block = entry.first;
 			previous_block_id = first_block;
 		} else if (previous_block_id + 1 == entry.first) {
-			// this block is adjacent to the previous block - add it to the batch read
+			// this block is adjacent to the previous block - add it to the run
 			previous_block_id = entry.first;
 		} else {
-			// this block is not adjacent to the previous block
-			// perform the batch read for the previous batch
-			BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+			// this block is not adjacent to the previous block - add the previous run to the batch
+			runs.emplace_back(first_block, previous_block_id);
+			batch_block_count += NumericCast<idx_t>(previous_block_id - first_block + 1);
+			if (batch_block_count >= MAX_PREFETCH_BATCH_BLOCKS) {
+				BatchRead(handles, to_be_loaded, runs);
+				runs.clear();
+				batch_block_count = 0;
+			}
 
 			// set the first_block and previous_block_id to the current block
 			first_block = entry.first;
@@ -295,7 +322,8 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 		}
 	}
 	// batch read the final batch
-	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+	runs.emplace_back(first_block, previous_block_id);
+	BatchRead(handles, to_be_loaded, runs);
 }
 
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
@@ -318,8 +346,10 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	}
 
 	if (buf.IsValid()) {
+		ThreadResourceCounters::AddBufferHit();
 		return buf; // the block was already loaded, return it without holding the BlockHandle's lock
 	} else {
+		ThreadResourceCounters::AddBufferMiss();
 		// evict blocks until we have space for the current block
 		unique_ptr<FileBuffer> reusable_buffer;
 		auto reservation =
@@ -457,11 +487,12 @@ void StandardBufferManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block
 
 	// WriteTemporaryBuffer assumes that we never write a buffer below DEFAULT_BLOCK_ALLOC_SIZE.
 	RequireTemporaryDirectory();
+	ThreadResourceCounters::AddTemporaryBytesWritten(buffer.size);
 
 	// Append to a few grouped files.
 	if (buffer.size == GetBlockSize()) {
 		evicted_data_per_tag[uint8_t(tag)] += GetBlockSize();
-		temporary_directory.handle->GetTempFile().WriteTemporaryBuffer(block_id, buffer);
+		temporary_directory.handle->GetTempFile().WriteTemporaryBuffer(tag, block_id, buffer);
 		return;
 	}
 
@@ -483,6 +514,7 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag,
 	D_ASSERT(temporary_directory.handle.get());
 	if (temporary_directory.handle->GetTempFile().HasTemporaryBuffer(id)) {
 		evicted_data_per_tag[uint8_t(tag)] -= GetBlockSize();
+		ThreadResourceCounters::AddTemporaryBytesRead(GetBlockSize());
 		return temporary_directory.handle->GetTempFile().ReadTemporaryBuffer(id, std::move(reusable_buffer));
 	}
 
@@ -493,6 +525,7 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag,
 	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
 	handle->Read(&block_size, sizeof(idx_t), 0);
 	evicted_data_per_tag[uint8_t(tag)] -= block_size;
+	ThreadResourceCounters::AddTemporaryBytesRead(block_size);
 
 	// Allocate a buffer of the file's size and read the data into that buffer.
 	auto buffer = ReadTemporaryBufferInternal(*this, *handle, sizeof(idx_t), block_size, std::move(reusable_buffer));
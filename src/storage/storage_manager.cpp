@@ -247,6 +247,8 @@ public:
 	void RevertCommit() override;
 	// Make the commit persistent
 	void FlushCommit() override;
+	//! Wait until the flushed commit has been synced to disk
+	void SyncCommit() override;
 
 	void AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
 	                     unique_ptr<PersistentCollectionData> row_group_data) override;
@@ -255,13 +257,16 @@ public:
 private:
 	idx_t initial_wal_size = 0;
 	idx_t initial_written = 0;
+	//! The size up to which the WAL has to be synced for this commit to be durable
+	idx_t sync_size = 0;
+	StorageManager &storage;
 	WriteAheadLog &wal;
 	WALCommitState state;
 	reference_map_t<DataTable, unordered_map<idx_t, OptimisticallyWrittenRowGroupData>> optimistically_written_data;
 };
 
 SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage, WriteAheadLog &wal)
-    : wal(wal), state(WALCommitState::IN_PROGRESS) {
+    : storage(storage), wal(wal), state(WALCommitState::IN_PROGRESS) {
 	auto initial_size = storage.GetWALSize();
 	initial_written = wal.GetTotalWritten();
 	initial_wal_size = initial_size;
@@ -293,10 +298,18 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	sync_size = wal.WriteFlush();
 	state = WALCommitState::FLUSHED;
 }
 
+void SingleFileStorageCommitState::SyncCommit() {
+	if (state != WALCommitState::FLUSHED) {
+		return;
+	}
+	auto &config = DBConfig::GetConfig(storage.GetDatabase());
+	wal.SyncUpTo(sync_size, config.options.wal_commit_delay, config.options.wal_async_commit);
+}
+
 void SingleFileStorageCommitState::AddRowGroupData(DataTable &table, idx_t start_index, idx_t count,
                                                    unique_ptr<PersistentCollectionData> row_group_data) {
 	auto &entries = optimistically_written_data[table];
@@ -1,7 +1,11 @@
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -188,6 +192,27 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 	return initial_remaining - remaining;
 }
 
+bool ColumnData::FilterVector(ColumnScanState &state, Vector &result, idx_t target_scan, SelectionVector &sel,
+                              idx_t &sel_count, const TableFilter &filter) {
+	D_ASSERT(GetVectorScanType(state, target_scan) == ScanVectorType::SCAN_ENTIRE_VECTOR);
+	state.previous_states.clear();
+	if (!state.initialized) {
+		D_ASSERT(state.current);
+		state.current->InitializeScan(state);
+		state.internal_index = state.current->start;
+		state.initialized = true;
+	}
+	if (state.internal_index < state.row_index) {
+		state.current->Skip(state);
+	}
+	if (!state.current->Filter(state, target_scan, result, sel, sel_count, filter)) {
+		return false;
+	}
+	state.row_index += target_scan;
+	state.internal_index = state.row_index;
+	return true;
+}
+
 unique_ptr<BaseStatistics> ColumnData::GetUpdateStatistics() {
 	lock_guard<mutex> update_guard(update_lock);
 	return updates ? updates->GetStatistics() : nullptr;
@@ -220,11 +245,15 @@ void ColumnData::FetchUpdateRow(TransactionData transaction, row_t row_id, Vecto
 
 void ColumnData::UpdateInternal(TransactionData transaction, idx_t column_index, Vector &update_vector, row_t *row_ids,
                                 idx_t update_count, Vector &base_vector) {
-	lock_guard<mutex> update_guard(update_lock);
-	if (!updates) {
-		updates = make_uniq<UpdateSegment>(*this);
+	{
+		lock_guard<mutex> update_guard(update_lock);
+		if (!updates) {
+			updates = make_uniq<UpdateSegment>(*this);
+		}
+		updates->Update(transaction, column_index, update_vector, row_ids, update_count, base_vector);
 	}
-	updates->Update(transaction, column_index, update_vector, row_ids, update_count, base_vector);
+	// the Bloom filter only covers the persisted values
+	SetBloomFilter(nullptr);
 }
 
 template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
@@ -331,6 +360,8 @@ void ColumnData::Append(ColumnAppendState &state, Vector &vector, idx_t append_c
 	}
 	lock_guard<mutex> l(stats_lock);
 	Append(stats->statistics, state, vector, append_count);
+	// the Bloom filter only covers the persisted values
+	bloom_filter.reset();
 }
 
 FilterPropagateResult ColumnData::CheckZonemap(ColumnScanState &state, TableFilter &filter) {
@@ -363,12 +394,64 @@ FilterPropagateResult ColumnData::CheckZonemap(ColumnScanState &state, TableFilt
 	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
 }
 
+static FilterPropagateResult CheckBloomFilter(const BloomFilter &bloom_filter, const LogicalType &type,
+                                              const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    constant_filter.constant.type().InternalType() != type.InternalType()) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		if (!bloom_filter.Contains(constant_filter.constant.Hash())) {
+			return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			if (value.type().InternalType() != type.InternalType() || bloom_filter.Contains(value.Hash())) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction_filter.child_filters) {
+			if (CheckBloomFilter(bloom_filter, type, *child_filter) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			}
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
 FilterPropagateResult ColumnData::CheckZonemap(TableFilter &filter) {
 	if (!stats) {
 		throw InternalException("ColumnData::CheckZonemap called on a column without stats");
 	}
 	lock_guard<mutex> l(stats_lock);
-	return filter.CheckStatistics(stats->statistics);
+	auto prune_result = filter.CheckStatistics(stats->statistics);
+	if (prune_result != FilterPropagateResult::NO_PRUNING_POSSIBLE || !bloom_filter) {
+		return prune_result;
+	}
+	// the min/max statistics are not conclusive - check the Bloom filter for equality predicates
+	return CheckBloomFilter(*bloom_filter, type, filter);
+}
+
+shared_ptr<BloomFilter> ColumnData::GetBloomFilter() const {
+	lock_guard<mutex> l(stats_lock);
+	return bloom_filter;
+}
+
+void ColumnData::SetBloomFilter(shared_ptr<BloomFilter> new_filter) {
+	lock_guard<mutex> l(stats_lock);
+	bloom_filter = std::move(new_filter);
 }
 
 unique_ptr<BaseStatistics> ColumnData::GetStatistics() {
@@ -571,7 +654,12 @@ unique_ptr<ColumnCheckpointState> ColumnData::Checkpoint(RowGroup &row_group, Co
 
 	// replace the old tree with the new one
 	data.Replace(l, checkpoint_state->new_tree);
-	ClearUpdates();
+	if (checkpoint_info.info.checkpoint_type == CheckpointType::FULL_CHECKPOINT) {
+		ClearUpdates();
+	}
+	// in a concurrent checkpoint other transactions might still need the versions from before the committed updates
+	// the new segments contain the latest committed values - we keep the version chains so older snapshots can roll back
+	SetBloomFilter(checkpoint_state->bloom_filter);
 
 	return checkpoint_state;
 }
@@ -601,6 +689,7 @@ void ColumnData::InitializeColumn(PersistentColumnData &column_data, BaseStatist
 
 		data.AppendSegment(std::move(segment));
 	}
+	bloom_filter = std::move(column_data.bloom_filter);
 }
 
 bool ColumnData::IsPersistent() {
@@ -645,6 +734,9 @@ void PersistentColumnData::Serialize(Serializer &serializer) const {
 		serializer.WriteList(102, "sub_columns", child_columns.size() - 1,
 		                     [&](Serializer::List &list, idx_t i) { list.WriteElement(child_columns[i + 1]); });
 	}
+	if (serializer.ShouldSerialize(4)) {
+		serializer.WritePropertyWithDefault(103, "bloom_filter", bloom_filter);
+	}
 }
 
 void PersistentColumnData::DeserializeField(Deserializer &deserializer, field_id_t field_idx, const char *field_name,
@@ -682,6 +774,7 @@ PersistentColumnData PersistentColumnData::Deserialize(Deserializer &deserialize
 	default:
 		break;
 	}
+	deserializer.ReadPropertyWithDefault(103, "bloom_filter", result.bloom_filter);
 	return result;
 }
 
@@ -719,7 +812,9 @@ PersistentCollectionData PersistentCollectionData::Deserialize(Deserializer &des
 }
 
 PersistentColumnData ColumnData::Serialize() {
-	return PersistentColumnData(type.InternalType(), GetDataPointers());
+	PersistentColumnData result(type.InternalType(), GetDataPointers());
+	result.bloom_filter = GetBloomFilter();
+	return result;
 }
 
 shared_ptr<ColumnData> ColumnData::Deserialize(BlockManager &block_manager, DataTableInfo &info, idx_t column_index,
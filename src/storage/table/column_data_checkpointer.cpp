@@ -1,4 +1,6 @@
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/common/types/bloom_filter.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -17,6 +19,11 @@ ColumnDataCheckpointer::ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup
 	auto &config = DBConfig::GetConfig(GetDatabase());
 	auto functions = config.GetCompressionFunctions(GetType().InternalType());
 	for (auto &func : functions) {
+		if (func.get().type == CompressionType::COMPRESSION_PFOR_DELTA &&
+		    !config.options.serialization_compatibility.Compare(4)) {
+			// PFOR-Delta segments can only be read by versions with serialization version 4 or higher
+			continue;
+		}
 		compression_functions.push_back(&func.get());
 	}
 }
@@ -198,13 +205,72 @@ void ColumnDataCheckpointer::WriteToDisk() {
 	auto best_function = compression_functions[compression_idx];
 	auto compress_state = best_function->init_compression(*this, std::move(analyze_state));
 
-	ScanSegments(
-	    [&](Vector &scan_vector, idx_t count) { best_function->compress(*compress_state, scan_vector, count); });
+	shared_ptr<BloomFilter> bloom_filter;
+	if (ShouldCreateBloomFilter()) {
+		idx_t total_count = 0;
+		for (auto &node : nodes) {
+			total_count += node.node->count;
+		}
+		auto block_count =
+		    BloomFilter::GetBlockCount(total_count, BLOOM_FILTER_BITS_PER_KEY, BLOOM_FILTER_MAX_BLOCKS);
+		bloom_filter = make_shared_ptr<BloomFilter>(block_count);
+	}
+	Vector hashes(LogicalType::HASH);
+	SelectionVector valid_sel(STANDARD_VECTOR_SIZE);
+	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		if (bloom_filter) {
+			// insert the hashes of all non-NULL values into the Bloom filter
+			UnifiedVectorFormat vdata;
+			scan_vector.ToUnifiedFormat(count, vdata);
+			idx_t valid_count = 0;
+			for (idx_t i = 0; i < count; i++) {
+				valid_sel.set_index(valid_count, i);
+				valid_count += vdata.validity.RowIsValid(vdata.sel->get_index(i));
+			}
+			VectorOperations::Hash(scan_vector, hashes, count);
+			hashes.Flatten(count);
+			bloom_filter->Insert(hashes, valid_sel, valid_count);
+		}
+		best_function->compress(*compress_state, scan_vector, count);
+	});
 	best_function->compress_finalize(*compress_state);
 
+	if (bloom_filter) {
+		// shrink the filter to the smallest size that still has an acceptable false positive rate
+		bloom_filter->Shrink(BLOOM_FILTER_MAX_FALSE_POSITIVE_RATE);
+		if (bloom_filter->FalsePositiveRate() <= BLOOM_FILTER_MAX_FALSE_POSITIVE_RATE) {
+			state.bloom_filter = std::move(bloom_filter);
+		}
+	}
+
 	nodes.clear();
 }
 
+bool ColumnDataCheckpointer::ShouldCreateBloomFilter() {
+	if (is_validity || col_data.parent) {
+		return false;
+	}
+	switch (GetType().InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::VARCHAR:
+		break;
+	default:
+		return false;
+	}
+	// Bloom filters can only be read by versions with serialization version 4 or higher
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	return config.options.serialization_compatibility.Compare(4);
+}
+
 bool ColumnDataCheckpointer::HasChanges() {
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto segment = nodes[segment_idx].node.get();
@@ -238,6 +304,8 @@ void ColumnDataCheckpointer::WritePersistentSegments() {
 
 		state.data_pointers.push_back(std::move(pointer));
 	}
+	// the data is unchanged - so is the Bloom filter
+	state.bloom_filter = col_data.GetBloomFilter();
 }
 
 void ColumnDataCheckpointer::Checkpoint(vector<SegmentNode<ColumnSegment>> nodes_p) {
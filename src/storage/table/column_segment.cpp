@@ -1,11 +1,14 @@
 #include "duckdb/storage/table/column_segment.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/limits.hpp"
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/bloom_table_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -139,6 +142,14 @@ void ColumnSegment::ScanPartial(ColumnScanState &state, idx_t scan_count, Vector
 	function.get().scan_partial(*this, state, scan_count, result, result_offset);
 }
 
+bool ColumnSegment::Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+                           idx_t &sel_count, const TableFilter &filter) {
+	if (!function.get().filter) {
+		return false;
+	}
+	return function.get().filter(*this, state, scan_count, result, sel, sel_count, filter);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -362,6 +373,49 @@ static void FilterSelectionSwitch(UnifiedVectorFormat &vdata, T predicate, Selec
 	sel.Initialize(new_sel);
 }
 
+template <class T>
+static void TemplatedInFilterSelection(UnifiedVectorFormat &vdata, const vector<Value> &values, SelectionVector &sel,
+                                       idx_t &approved_tuple_count) {
+	// gather the values of the IN list and sort them so we can use binary search for large lists
+	auto in_count = values.size();
+	auto in_values = make_unsafe_uniq_array<T>(in_count);
+	for (idx_t i = 0; i < in_count; i++) {
+		in_values[i] = values[i].GetValueUnsafe<T>();
+	}
+	auto in_begin = in_values.get();
+	auto in_end = in_values.get() + in_count;
+	std::sort(in_begin, in_end, [](const T &a, const T &b) { return LessThan::Operation<T>(a, b); });
+	static constexpr idx_t LINEAR_SEARCH_THRESHOLD = 8;
+
+	auto &mask = vdata.validity;
+	auto vec = UnifiedVectorFormat::GetData<T>(vdata);
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto vector_idx = vdata.sel->get_index(idx);
+		if (!mask.RowIsValid(vector_idx)) {
+			continue;
+		}
+		auto &input = vec[vector_idx];
+		bool found;
+		if (in_count <= LINEAR_SEARCH_THRESHOLD) {
+			found = false;
+			for (idx_t in_idx = 0; in_idx < in_count; in_idx++) {
+				found = found || Equals::Operation<T>(input, in_values[in_idx]);
+			}
+		} else {
+			auto entry = std::lower_bound(in_begin, in_end, input,
+			                              [](const T &a, const T &b) { return LessThan::Operation<T>(a, b); });
+			found = entry != in_end && Equals::Operation<T>(*entry, input);
+		}
+		result_sel.set_index(result_count, idx);
+		result_count += found;
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+}
+
 template <bool IS_NULL>
 static idx_t TemplatedNullSelection(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) {
 	auto &mask = vdata.validity;
@@ -530,6 +584,60 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return FilterSelection(sel, *child_vec, child_data, *struct_filter.child_filter, scan_count,
 		                       approved_tuple_count);
 	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		switch (vector.GetType().InternalType()) {
+		case PhysicalType::UINT8:
+			TemplatedInFilterSelection<uint8_t>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::UINT16:
+			TemplatedInFilterSelection<uint16_t>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::UINT32:
+			TemplatedInFilterSelection<uint32_t>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::UINT64:
+			TemplatedInFilterSelection<uint64_t>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::UINT128:
+			TemplatedInFilterSelection<uhugeint_t>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::INT8:
+			TemplatedInFilterSelection<int8_t>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::INT16:
+			TemplatedInFilterSelection<int16_t>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::INT32:
+			TemplatedInFilterSelection<int32_t>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::INT64:
+			TemplatedInFilterSelection<int64_t>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::INT128:
+			TemplatedInFilterSelection<hugeint_t>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::FLOAT:
+			TemplatedInFilterSelection<float>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::DOUBLE:
+			TemplatedInFilterSelection<double>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::VARCHAR:
+			TemplatedInFilterSelection<string_t>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		case PhysicalType::BOOL:
+			TemplatedInFilterSelection<bool>(vdata, in_filter.values, sel, approved_tuple_count);
+			break;
+		default:
+			throw InvalidTypeException(vector.GetType(), "Invalid type for IN filter pushed down to table");
+		}
+		return approved_tuple_count;
+	}
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomTableFilter>();
+		return bloom_filter.Filter(vector, vdata, sel, approved_tuple_count, scan_count);
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
@@ -727,8 +727,21 @@ struct VacuumState {
 	idx_t row_start = 0;
 	idx_t next_vacuum_idx = 0;
 	vector<idx_t> row_group_counts;
+	//! The fraction of deleted rows at which a row group is rewritten, even if it cannot be merged with other row groups
+	double compaction_threshold = 0;
+	//! The number of rows that can still be rewritten during this checkpoint
+	idx_t remaining_rewrite_rows = 0;
+	//! The number of row groups and rows that are rewritten during this checkpoint
+	idx_t compacted_row_groups = 0;
+	idx_t compacted_rows = 0;
 };
 
+//! Whether or not enough rows of the row group have been deleted to rewrite it
+static bool ShouldCompactRowGroup(idx_t count, idx_t committed_count, double threshold) {
+	auto deleted_count = count - committed_count;
+	return deleted_count > 0 && static_cast<double>(deleted_count) >= threshold * static_cast<double>(count);
+}
+
 class VacuumTask : public BaseCheckpointTask {
 public:
 	VacuumTask(CollectionCheckpointState &checkpoint_state, VacuumState &vacuum_state, idx_t segment_idx,
@@ -851,6 +864,12 @@ void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkp
 	if (!state.can_vacuum_deletes) {
 		return;
 	}
+	auto &config = DBConfig::GetConfig(info->GetDB().GetDatabase());
+	state.compaction_threshold = config.options.compaction_threshold;
+	state.remaining_rewrite_rows = config.options.compaction_row_limit;
+	if (state.remaining_rewrite_rows == 0) {
+		state.remaining_rewrite_rows = NumericLimits<idx_t>::Maximum();
+	}
 	// obtain the set of committed row counts for each row group
 	state.row_group_counts.reserve(segments.size());
 	for (auto &entry : segments) {
@@ -917,8 +936,25 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		}
 	}
 	if (!perform_merge) {
+		// we cannot reduce the amount of row groups - but we can still rewrite this row group on its own
+		// if a large enough fraction of its rows has been deleted
+		auto &row_group = *checkpoint_state.segments[segment_idx].node;
+		if (!ShouldCompactRowGroup(row_group.count, state.row_group_counts[segment_idx], state.compaction_threshold)) {
+			return false;
+		}
+		merge_count = 1;
+		target_count = 1;
+		merge_rows = state.row_group_counts[segment_idx];
+		next_idx = segment_idx + 1;
+	}
+	if (merge_rows > state.remaining_rewrite_rows) {
+		// we have exhausted the rows we can rewrite in this checkpoint - leave the remainder to the next checkpoint
+		state.remaining_rewrite_rows = 0;
 		return false;
 	}
+	state.remaining_rewrite_rows -= merge_rows;
+	state.compacted_row_groups += merge_count;
+	state.compacted_rows += merge_rows;
 	// schedule the vacuum task
 	auto vacuum_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, merge_count, target_count,
 	                                         merge_rows, state.row_start);
@@ -964,6 +1000,7 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 	}
 	// all tasks have been scheduled - execute tasks until we are done
 	checkpoint_state.executor.WorkOnTasks();
+	info->AddCompaction(vacuum_state.compacted_row_groups, vacuum_state.compacted_rows);
 
 	// no errors - finalize the row groups
 	idx_t new_total_rows = 0;
@@ -1013,6 +1050,25 @@ vector<ColumnSegmentInfo> RowGroupCollection::GetColumnSegmentInfo() {
 	return result;
 }
 
+RowGroupCompactionInfo RowGroupCollection::GetCompactionInfo() {
+	RowGroupCompactionInfo result;
+	auto &config = DBConfig::GetConfig(info->GetDB().GetDatabase());
+	result.can_compact = info->GetIndexes().Empty();
+	for (auto &row_group : row_groups->Segments()) {
+		auto committed_count = row_group.GetCommittedRowCount();
+		result.row_group_count++;
+		result.total_rows += row_group.count;
+		result.deleted_rows += row_group.count - committed_count;
+		if (result.can_compact &&
+		    ShouldCompactRowGroup(row_group.count, committed_count, config.options.compaction_threshold)) {
+			result.pending_row_groups++;
+		}
+	}
+	result.compacted_row_groups = info->GetCompactedRowGroups();
+	result.compacted_rows = info->GetCompactedRows();
+	return result;
+}
+
 //===--------------------------------------------------------------------===//
 // Alter
 //===--------------------------------------------------------------------===//
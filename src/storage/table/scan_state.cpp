@@ -214,6 +214,18 @@ bool CollectionScanState::ScanCommitted(DataChunk &result, TableScanType type) {
 	return false;
 }
 
+void CollectionScanState::InitializePrefetch(PrefetchState &prefetch_state) {
+	if (!row_group) {
+		return;
+	}
+	idx_t current_row = vector_index * STANDARD_VECTOR_SIZE;
+	if (current_row >= max_row_group_row) {
+		return;
+	}
+	auto max_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, max_row_group_row - current_row);
+	row_group->InitializePrefetch(*this, prefetch_state, max_count);
+}
+
 PrefetchState::~PrefetchState() {
 }
 
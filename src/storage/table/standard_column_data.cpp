@@ -76,6 +76,48 @@ idx_t StandardColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_
 	return scan_count;
 }
 
+static bool SelectionIsSorted(const SelectionVector &sel, idx_t count) {
+	if (!sel.IsSet()) {
+		return true;
+	}
+	for (idx_t i = 1; i < count; i++) {
+		if (sel.get_index(i - 1) >= sel.get_index(i)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                Vector &result, SelectionVector &sel, idx_t &count, const TableFilter &filter) {
+	// we can only evaluate the filter on the compressed data if we scan an entire vector from a single segment,
+	// without any updates, and if the compression method supports the filter
+	// the compression methods walk over the selection in order, so it needs to be sorted
+	auto target_count = GetVectorCount(vector_index);
+	bool force_fetch_row = state.scan_options && state.scan_options->force_fetch_row;
+	if (force_fetch_row || GetVectorScanType(state, target_count) != ScanVectorType::SCAN_ENTIRE_VECTOR ||
+	    !SelectionIsSorted(sel, count) || !FilterVector(state, result, target_count, sel, count, filter)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, count, filter);
+		return;
+	}
+	// the filter was evaluated without looking at the validity - scan the validity and remove any NULL values
+	validity.Scan(transaction, vector_index, state.child_states[0], result, target_count);
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(target_count, vdata);
+	if (vdata.validity.AllValid()) {
+		return;
+	}
+	SelectionVector valid_sel(count);
+	idx_t valid_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = sel.get_index(i);
+		valid_sel.set_index(valid_count, idx);
+		valid_count += vdata.validity.RowIsValid(vdata.sel->get_index(idx));
+	}
+	sel.Initialize(valid_sel);
+	count = valid_count;
+}
+
 void StandardColumnData::InitializeAppend(ColumnAppendState &state) {
 	ColumnData::InitializeAppend(state);
 	ColumnAppendState child_append;
@@ -1,6 +1,9 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "lz4.hpp"
 
 namespace duckdb {
 
@@ -8,10 +11,11 @@ namespace duckdb {
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), manager(&manager), block_size(block_size) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr), block_size(0) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -58,7 +62,6 @@ bool BlockIndexManager::HasFreeBlocks() {
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +69,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -94,11 +97,20 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string TemporaryFileName(DatabaseInstance &db, idx_t index, idx_t slot_size) {
+	if (slot_size == BufferManager::GetBufferManager(db).GetBlockAllocSize()) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	// files with compressed blocks are named after their slot size
+	return "duckdb_temp_storage_" + to_string(slot_size / 1024) + "K-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
+                                         idx_t index, idx_t slot_size, TemporaryFileManager &manager)
     : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      slot_size(slot_size),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, TemporaryFileName(db, index, slot_size))),
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -117,17 +129,51 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+bool TemporaryFileHandle::IsCompressed() const {
+	return slot_size < BufferManager::GetBufferManager(db).GetBlockAllocSize();
+}
+
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	if (!IsCompressed()) {
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+		return;
+	}
+	// write the compressed size followed by the compressed block
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	D_ASSERT(sizeof(idx_t) + compressed_size <= slot_size);
+	handle->Write(compressed_buffer.get(), sizeof(idx_t) + compressed_size, GetPositionInFile(index.block_index));
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto position = GetPositionInFile(block_index);
+	if (!IsCompressed()) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(
+		    buffer_manager, *handle, position, buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	}
+
+	// read the compressed size, followed by the compressed block
+	idx_t compressed_size;
+	handle->Read(&compressed_size, sizeof(idx_t), position);
+	if (sizeof(idx_t) + compressed_size > slot_size) {
+		throw IOException("Corrupt temporary file \"%s\": compressed block of size %llu does not fit in a slot of %llu",
+		                  path, compressed_size, slot_size);
+	}
+	auto compressed_buffer = Allocator::Get(db).Allocate(compressed_size);
+	handle->Read(compressed_buffer.get(), compressed_size, position + sizeof(idx_t));
+
+	auto buffer = buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(
+	    char_ptr_cast(compressed_buffer.get()), char_ptr_cast(buffer->buffer), NumericCast<int>(compressed_size),
+	    NumericCast<int>(buffer->size));
+	if (decompressed_size < 0 || NumericCast<idx_t>(decompressed_size) != buffer->size) {
+		throw IOException("Corrupt temporary file \"%s\": failed to decompress block", path);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -181,7 +227,40 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * slot_size;
+}
+
+//===--------------------------------------------------------------------===//
+// TemporaryFileCompressionAdaptivity
+//===--------------------------------------------------------------------===//
+
+TemporaryCompressionCodec TemporaryFileCompressionAdaptivity::GetCodec() {
+	auto skip = skipped_blocks.load();
+	if (skip > 0) {
+		// the last block that we compressed did not compress: write this one uncompressed
+		// this is racy, but it does not matter if a block more or less is compressed
+		skipped_blocks = skip - 1;
+		return TemporaryCompressionCodec::UNCOMPRESSED;
+	}
+	// if the data compresses well we spend some more time on compression, otherwise we only use the fastest level
+	return compresses_well ? TemporaryCompressionCodec::LZ4 : TemporaryCompressionCodec::LZ4_FAST;
+}
+
+void TemporaryFileCompressionAdaptivity::Update(TemporaryCompressionCodec codec, idx_t uncompressed_size,
+                                                idx_t slot_size) {
+	if (codec == TemporaryCompressionCodec::UNCOMPRESSED) {
+		return;
+	}
+	if (slot_size >= uncompressed_size) {
+		// the block did not compress into a smaller size class: back off
+		auto current_backoff = backoff.load();
+		skipped_blocks = current_backoff;
+		backoff = MinValue<idx_t>(current_backoff * 2, MAX_SKIPPED_BLOCKS);
+		compresses_well = false;
+		return;
+	}
+	backoff = 1;
+	compresses_well = slot_size <= uncompressed_size / 2;
 }
 
 //===--------------------------------------------------------------------===//
@@ -277,17 +356,65 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
-void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
+//! The number of size classes of the slots in the temporary files, e.g. with 256KiB blocks compressed blocks are
+//! stored in slots of 32KiB, 64KiB, ..., 224KiB
+static constexpr idx_t TEMPORARY_FILE_SIZE_CLASSES = 8;
+//! The acceleration of LZ4 for data that does not compress well, higher is faster (but compresses less)
+static constexpr int LZ4_FAST_ACCELERATION = 8;
+
+idx_t TemporaryFileManager::CompressBuffer(MemoryTag tag, FileBuffer &buffer, AllocatedData &compressed_buffer) {
+	auto block_alloc_size = BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	if (!DBConfig::GetConfig(db).options.temp_file_compression) {
+		return block_alloc_size;
+	}
+	auto &adaptivity = compression_adaptivity[static_cast<uint8_t>(tag)];
+	auto codec = adaptivity.GetCodec();
+	if (codec == TemporaryCompressionCodec::UNCOMPRESSED) {
+		return block_alloc_size;
+	}
+
+	// compress the block after the space that is reserved for the compressed size
+	auto bound = duckdb_lz4::LZ4_compressBound(NumericCast<int>(buffer.size));
+	compressed_buffer = Allocator::Get(db).Allocate(sizeof(idx_t) + NumericCast<idx_t>(bound));
+	auto acceleration = codec == TemporaryCompressionCodec::LZ4 ? 1 : LZ4_FAST_ACCELERATION;
+	auto compressed_size = duckdb_lz4::LZ4_compress_fast(char_ptr_cast(buffer.buffer),
+	                                                     char_ptr_cast(compressed_buffer.get() + sizeof(idx_t)),
+	                                                     NumericCast<int>(buffer.size), bound, acceleration);
+
+	// find the smallest size class that fits the compressed block
+	auto slot_size = block_alloc_size;
+	if (compressed_size > 0) {
+		auto stored_size = sizeof(idx_t) + NumericCast<idx_t>(compressed_size);
+		auto size_class = block_alloc_size / TEMPORARY_FILE_SIZE_CLASSES;
+		slot_size = MinValue(block_alloc_size, (stored_size + size_class - 1) / size_class * size_class);
+		Store<idx_t>(NumericCast<idx_t>(compressed_size), compressed_buffer.get());
+	}
+	adaptivity.Update(codec, block_alloc_size, slot_size);
+	if (slot_size == block_alloc_size) {
+		// not worth it: write the block uncompressed
+		compressed_buffer.Reset();
+	}
+	return slot_size;
+}
+
+void TemporaryFileManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
+	AllocatedData compressed_buffer;
+	auto slot_size = CompressBuffer(tag, buffer, compressed_buffer);
+
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
-
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with slots of this size
+		idx_t file_count = 0;
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
+			file_count++;
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -297,7 +424,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(file_count, db, temp_directory, new_file_index, slot_size, *this);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -308,7 +436,7 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -25,6 +25,7 @@
 #include "duckdb/planner/expression_binder/index_binder.hpp"
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
@@ -43,6 +44,31 @@ public:
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+	//! The offset in the WAL file directly after the last flush entry, i.e. the end of the last complete transaction
+	idx_t flushed_offset = 0;
+	//! The connection used to commit the replayed changes (if any)
+	optional_ptr<Connection> connection;
+
+public:
+	//! Append a chunk to the current table. Consecutive inserts into the same table share a single append
+	void Append(DataChunk &chunk);
+	//! Finalize the append to the current table (if any)
+	void FinalizeAppend();
+	//! Called before an entry that is not an insert is replayed
+	void BeginEntry();
+	//! Called when the end of a transaction in the WAL is reached
+	void EndTransaction();
+	//! Commits the replayed changes and starts a new transaction
+	void Commit(bool begin_transaction = true);
+
+private:
+	//! The table that is currently being appended to
+	optional_ptr<TableCatalogEntry> append_table;
+	unique_ptr<LocalAppendState> append_state;
+	//! Whether or not the changes of complete (insert-only) transactions are pending in the replay transaction
+	bool pending_transactions = false;
+	//! Whether or not the transaction that is currently being replayed contains entries other than inserts
+	bool requires_commit = false;
 };
 
 class WriteAheadLogDeserializer {
@@ -100,8 +126,16 @@ public:
 		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
 		if (wal_type == WALType::WAL_FLUSH) {
 			deserializer.End();
+			if (!DeserializeOnly()) {
+				state.EndTransaction();
+			}
 			return true;
 		}
+		if (DeserializeOnly() && data && IsDataEntry(wal_type)) {
+			// the entry has been read into its own buffer - we don't need to deserialize the data when looking for
+			// the checkpoint flag
+			return false;
+		}
 		ReplayEntry(wal_type);
 		deserializer.End();
 		return false;
@@ -111,6 +145,12 @@ public:
 		return deserialize_only;
 	}
 
+	//! Whether or not the entry only modifies table data that was written by a regular append, delete or update
+	static bool IsDataEntry(WALType wal_type) {
+		return wal_type == WALType::INSERT_TUPLE || wal_type == WALType::DELETE_TUPLE ||
+		       wal_type == WALType::UPDATE_TUPLE;
+	}
+
 protected:
 	void ReplayEntry(WALType wal_type);
 
@@ -178,12 +218,15 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 	auto &config = DBConfig::GetConfig(database.GetDatabase());
 	// first deserialize the WAL to look for a checkpoint flag
 	// if there is a checkpoint flag, we might have already flushed the contents of the WAL to disk
+	// this also finds the end of the last complete transaction in the WAL
 	ReplayState checkpoint_state(database, *con.context);
+	ErrorData torn_wal_error;
 	try {
 		while (true) {
 			// read the current entry (deserialize only)
 			auto deserializer = WriteAheadLogDeserializer::Open(checkpoint_state, reader, true);
 			if (deserializer.ReplayEntry()) {
+				checkpoint_state.flushed_offset = reader.CurrentOffset();
 				// check if the file is exhausted
 				if (reader.Finished()) {
 					// we finished reading the file: break
@@ -197,6 +240,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		if (error.Type() != ExceptionType::SERIALIZATION) {
 			error.Throw("Failure while replaying WAL file \"" + wal_path + "\": ");
 		}
+		torn_wal_error = std::move(error);
 	} // LCOV_EXCL_STOP
 	if (checkpoint_state.checkpoint_id.IsValid()) {
 		// there is a checkpoint flag: check if we need to deserialize the WAL
@@ -210,28 +254,22 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 
 	// we need to recover from the WAL: actually set up the replay state
 	ReplayState state(database, *con.context);
+	state.connection = con;
 
 	// reset the reader - we are going to read the WAL from the beginning again
 	reader.Reset();
 
-	// replay the WAL
+	// replay the WAL up to the end of the last complete transaction
+	// consecutive transactions that only insert data are replayed and committed together (see ReplayState)
 	// note that everything is wrapped inside a try/catch block here
 	// there can be errors in WAL replay because of a corrupt WAL file
 	try {
-		while (true) {
-			// read the current entry
+		while (reader.CurrentOffset() < checkpoint_state.flushed_offset) {
+			// read and replay the current entry
 			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
-			if (deserializer.ReplayEntry()) {
-				con.Commit();
-				// check if the file is exhausted
-				if (reader.Finished()) {
-					// we finished reading the file: break
-					break;
-				}
-				con.BeginTransaction();
-				MetaTransaction::Get(*con.context).ModifyDatabase(database);
-			}
+			deserializer.ReplayEntry();
 		}
+		state.Commit(false);
 	} catch (std::exception &ex) { // LCOV_EXCL_START
 		// exception thrown in WAL replay: rollback
 		con.Query("ROLLBACK");
@@ -247,13 +285,80 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		con.Query("ROLLBACK");
 		throw;
 	} // LCOV_EXCL_STOP
+	if (torn_wal_error.HasError() && config.options.abort_on_wal_failure) {
+		torn_wal_error.Throw("Failure while replaying WAL file \"" + wal_path + "\": ");
+	}
 	return false;
 }
 
+//===--------------------------------------------------------------------===//
+// Replay State
+//===--------------------------------------------------------------------===//
+// Every transaction in the WAL used to be replayed in its own transaction, appending and committing one chunk at a
+// time. Instead, consecutive transactions that only insert data are replayed in a single transaction: their chunks
+// are appended through a single local append per table, and the row groups and indexes of the tables are updated once
+// when the batch is committed. Any other entry (deletes, updates, catalog changes, ...) first commits the pending
+// transactions, so it observes the same state as during the original execution.
+void ReplayState::Append(DataChunk &chunk) {
+	if (append_table && append_table.get() != current_table.get()) {
+		FinalizeAppend();
+	}
+	auto &storage = current_table->GetStorage();
+	if (!append_state) {
+		// we don't do any constraint verification here - the constraints were verified when the data was committed
+		vector<unique_ptr<BoundConstraint>> bound_constraints;
+		append_state = make_uniq<LocalAppendState>();
+		storage.InitializeLocalAppend(*append_state, *current_table, context, bound_constraints);
+		append_table = current_table;
+	}
+	storage.LocalAppend(*append_state, *current_table, context, chunk, true);
+}
+
+void ReplayState::FinalizeAppend() {
+	if (!append_state) {
+		return;
+	}
+	append_table->GetStorage().FinalizeLocalAppend(*append_state);
+	append_state.reset();
+	append_table = nullptr;
+}
+
+void ReplayState::BeginEntry() {
+	FinalizeAppend();
+	if (pending_transactions) {
+		Commit();
+	}
+	requires_commit = true;
+}
+
+void ReplayState::EndTransaction() {
+	if (requires_commit) {
+		Commit();
+		requires_commit = false;
+	} else {
+		pending_transactions = true;
+	}
+}
+
+void ReplayState::Commit(bool begin_transaction) {
+	FinalizeAppend();
+	auto &con = *connection;
+	con.Commit();
+	pending_transactions = false;
+	if (begin_transaction) {
+		con.BeginTransaction();
+		MetaTransaction::Get(*con.context).ModifyDatabase(db);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Replay Entries
 //===--------------------------------------------------------------------===//
 void WriteAheadLogDeserializer::ReplayEntry(WALType entry_type) {
+	if (!DeserializeOnly() && entry_type != WALType::INSERT_TUPLE && entry_type != WALType::USE_TABLE &&
+	    entry_type != WALType::SEQUENCE_VALUE) {
+		state.BeginEntry();
+	}
 	switch (entry_type) {
 	case WALType::WAL_VERSION:
 		ReplayVersion();
@@ -654,9 +759,7 @@ void WriteAheadLogDeserializer::ReplayInsert() {
 	}
 
 	// append to the current table
-	// we don't do any constraint verification here
-	vector<unique_ptr<BoundConstraint>> bound_constraints;
-	state.current_table->GetStorage().LocalAppend(*state.current_table, context, chunk, bound_constraints);
+	state.Append(chunk);
 }
 
 static void MarkBlocksAsUsed(BlockManager &manager, const PersistentColumnData &col_data) {
@@ -14,6 +14,7 @@
 #include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/common/checksum.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 
@@ -414,6 +415,71 @@ void WriteAheadLog::Flush() {
 	// flushes all changes made to the WAL to disk
 	writer->Sync();
 	wal_size = writer->GetFileSize();
+
+	lock_guard<mutex> guard(sync_lock);
+	synced_size = MaxValue<idx_t>(synced_size, wal_size);
+}
+
+idx_t WriteAheadLog::WriteFlush() {
+	if (!writer) {
+		return 0;
+	}
+
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// write the buffered changes to the file - syncing the file is left to SyncUpTo
+	writer->Flush();
+	wal_size = writer->GetFileSize();
+
+	lock_guard<mutex> guard(sync_lock);
+	requested_size = MaxValue<idx_t>(requested_size, wal_size);
+	return wal_size;
+}
+
+void WriteAheadLog::SyncUpTo(idx_t size, idx_t commit_delay, bool async) {
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_size < size) {
+		if (sync_in_progress) {
+			if (async) {
+				// another committer is already syncing the WAL
+				return;
+			}
+			// another committer is syncing the WAL - wait for it to finish, as it might include our changes
+			sync_finished.wait(guard);
+			continue;
+		}
+		auto delay = std::chrono::microseconds(commit_delay);
+		if (async && steady_clock::now() - last_sync < delay) {
+			// the WAL has been synced recently - leave our changes to be synced by a later commit
+			return;
+		}
+		// we sync the WAL on behalf of all committers that are waiting
+		sync_in_progress = true;
+		guard.unlock();
+		if (!async && commit_delay > 0) {
+			// give concurrent transactions the chance to write their changes so they are synced together with ours
+			std::this_thread::sleep_for(delay);
+		}
+		guard.lock();
+		// all WAL entries up to the requested size have been written to the file by now
+		auto sync_size = requested_size;
+		guard.unlock();
+		try {
+			writer->handle->Sync();
+		} catch (...) {
+			guard.lock();
+			sync_in_progress = false;
+			sync_finished.notify_all();
+			throw;
+		}
+		guard.lock();
+		synced_size = MaxValue<idx_t>(synced_size, sync_size);
+		sync_in_progress = false;
+		last_sync = steady_clock::now();
+		sync_finished.notify_all();
+	}
 }
 
 } // namespace duckdb
@@ -132,14 +132,11 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 				return CheckpointDecision("Transaction has dropped catalog entries and there are other transactions "
 				                          "active\nActive transactions: " +
 				                          other_transactions);
-			} else if (undo_properties.has_updates) {
-				// this transaction has performed updates - we cannot checkpoint
-				return CheckpointDecision(
-				    "Transaction has performed updates and there are other transactions active\nActive transactions: " +
-				    other_transactions);
 			} else {
-				// this transaction has performed deletes - we cannot vacuum - initiate a concurrent checkpoint instead
-				D_ASSERT(undo_properties.has_deletes);
+				// this transaction has performed updates or deletes - initiate a concurrent checkpoint instead
+				// a concurrent checkpoint does not vacuum deletes, and keeps the in-memory update chains around so
+				// that the other transactions can still read the versions from before this transaction
+				D_ASSERT(undo_properties.has_updates || undo_properties.has_deletes);
 				checkpoint_type = CheckpointType::CONCURRENT_CHECKPOINT;
 			}
 		}
@@ -256,7 +253,7 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	transaction_t commit_id = GetCommitTimestamp();
 	// commit the UndoBuffer of the transaction
 	if (!error.HasError()) {
-		error = transaction.Commit(db, commit_id, std::move(commit_state));
+		error = transaction.Commit(db, commit_id, commit_state.get());
 	}
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
@@ -268,6 +265,20 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		if (transaction.catalog_version >= TRANSACTION_ID_START) {
 			transaction.catalog_version = ++last_committed_version;
 		}
+		if (commit_state) {
+			// the commit has been written to the WAL - wait for it to be synced to disk
+			// we release the WAL lock and the transaction lock while waiting, so that concurrent committers can write
+			// their changes to the WAL in the meantime and have them synced together with ours (group commit)
+			// the transaction is still active - so its write lock prevents a checkpoint from replacing the WAL
+			held_wal_lock.reset();
+			tlock.unlock();
+			try {
+				commit_state->SyncCommit();
+			} catch (std::exception &ex) {
+				error = ErrorData(ex);
+			}
+			tlock.lock();
+		}
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
@@ -6,6 +6,7 @@
 #include "duckdb/main/client_config.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 
@@ -378,6 +379,22 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 
 		return child_expr;
 	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter->Cast<InFilter>();
+		auto constant_field = field(py::tuple(py::cast(column_ref)));
+		py::object expression = py::none();
+		for (auto &value : in_filter.values) {
+			auto constant_value = GetScalar(value, timezone_config, type);
+			auto child_expression = constant_field.attr("__eq__")(constant_value);
+			expression = expression.is_none() ? child_expression : expression.attr("__or__")(child_expression);
+		}
+		return expression;
+	}
+	case TableFilterType::BLOOM_FILTER: {
+		//! Bloom filters can only remove rows that are eliminated by the join anyway - push "true" instead
+		auto dataset_scalar = import_cache.pyarrow.dataset().attr("scalar");
+		return dataset_scalar(true);
+	}
 	default:
 		throw NotImplementedException("Pushdown Filter Type not supported in Arrow Scans");
 	}